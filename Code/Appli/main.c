@@ -20,12 +20,33 @@
 //=============================================================================
 #include "Platform_Types.h"
 #include "Cpu.h"
+#include "Clock.h"
+#include "ClockMeas.h"
+#include "Idle.h"
+#include "Ring.h"
+#include "Timer.h"
 #include "Gpio.h"
 #include "SysTickTimer.h"
+#include "BootProfile.h"
+#include "Startup.h"
 
 //=============================================================================
 // Macros
 //=============================================================================
+/* Blink half period, BlockingDelay spends 3 clk_sys cycles per loop */
+#define MAIN_BLINK_HALF_PERIOD_US    180000UL
+#define MAIN_BLINK_CYCLES_PER_LOOP   3UL
+/* 1: after the core synchronization, core 0 streams MAIN_BENCH_WORDS words to core 1
+      through a ring buffer, the result is left in main_RingBench before the blinky starts */
+#ifndef MAIN_RING_BENCHMARK
+  #define MAIN_RING_BENCHMARK          0
+#endif
+
+#define MAIN_BENCH_RING_SIZE         1024UL
+#define MAIN_BENCH_BATCH             32UL
+#define MAIN_BENCH_WORDS             (256UL * 1024UL)
+
+#define MAIN_BLINK_DELAY(f)          ((((f) / 1000000UL) * MAIN_BLINK_HALF_PERIOD_US) / MAIN_BLINK_CYCLES_PER_LOOP)
 
 //=============================================================================
 // Prototypes
@@ -33,10 +54,33 @@
 void main_Core0(void);
 void main_Core1(void);
 void BlockingDelay(uint32 delay);
+static void main_ClockChanged(uint32 u32SysFreqHz);
+#if (MAIN_RING_BENCHMARK == 1)
+static void main_RingBenchProducer(void);
+static void main_RingBenchConsumer(void);
+#endif
 
 //=============================================================================
 // Globals
 //=============================================================================
+static volatile uint32 main_u32BlinkDelay = MAIN_BLINK_DELAY(CLOCK_SYS_FREQ_HZ);
+
+#if (MAIN_RING_BENCHMARK == 1)
+static Ring_Type main_BenchRing;
+static uint32 main_BenchBuffer[MAIN_BENCH_RING_SIZE] __attribute__((aligned(4)));
+
+/* Benchmark result (consumer side) */
+typedef struct
+{
+  uint32 u32Words;
+  uint32 u32Errors;
+  uint32 u32DurationUs;
+  uint32 u32WordsPerMs;
+}main_RingBenchType;
+
+volatile main_RingBenchType main_RingBench;
+#endif
+
 #ifdef DEBUG
   volatile boolean boHaltCore0 = TRUE;
   volatile boolean boHaltCore1 = TRUE;
@@ -57,8 +101,12 @@ int main(void)
   /* Synchronize with core 1 */
   RP2040_MulticoreSync(SIO->CPUID);
 
-  /* endless loop on the core 0 */
-  for(;;);
+#if (MAIN_RING_BENCHMARK == 1)
+  main_RingBenchProducer();
+#endif
+
+  /* Park the core 0 (woken up by events only) */
+  RP2040_IdleLoop();
 
   /* never reached */
   return(0);
@@ -73,6 +121,8 @@ int main(void)
 //-----------------------------------------------------------------------------------------
 void main_Core0(void)
 {
+  Clock_GateProfileType GateProfile;
+
 #ifdef DEBUG
   while(boHaltCore0);
 #endif
@@ -80,13 +130,40 @@ void main_Core0(void)
   /* Disable interrupts on core 0 */
   __asm volatile("CPSID i");
 
+  /* Let the mailbox interrupt wake the core 0 from WFE */
+  RP2040_IdleInit();
+
+  /* Complete the switch to PLL_SYS after a fast ROSC boot (immediate otherwise) */
+  RP2040_ClockCompleteDeferred();
+
+  /* Measure the clock tree, the results stay in ClockMeas_Table/ClockMeas_u32FailMask */
+  (void)RP2040_ClockMeasAll();
+
   /* Output disable on pin 25 */
   LED_GREEN_CFG();
 
+#if (MAIN_RING_BENCHMARK == 1)
+  /* The ring is set up before the consumer core starts */
+  (void)RP2040_RingInit(&main_BenchRing, main_BenchBuffer, MAIN_BENCH_RING_SIZE, RING_NO_DOORBELL);
+
+  if(RESETS->RESET_DONE.bit.timer == 0U)
+  {
+    RP2040_TimerInit();
+  }
+#endif
+
   /* Start the Core 1 and turn on the led to be sure that we passed successfully the core 1 initiaization */
   if(TRUE == RP2040_StartCore1())
   {
+    BootProfile_Stamp(BOOT_PHASE_CORE1_START);
     LED_GREEN_ON();
+
+    /* Both cores are up, build the deferred objects */
+    Startup_InitDeferredCtors();
+
+    /* All drivers are initialized: stop the clocks of the unused blocks */
+    RP2040_ClockGateBuildProfile(0UL, &GateProfile);
+    RP2040_ClockGateApply(&GateProfile);
   }
   else
   {
@@ -121,12 +198,124 @@ void main_Core1(void)
   /* Clear all pending interrupts on core 1 */
   NVIC->ICPR[0] = (uint32)-1;
 
+  /* Build the objects owned by core 1 */
+  Startup_InitCore1Ctors();
+
+  /* Keep the blink period when clk_sys changes */
+  (void)RP2040_ClockRegisterNotifier(&main_ClockChanged);
+
+  /* Let the mailbox interrupt wake the core 1 from WFE */
+  RP2040_IdleInit();
+
   /* Synchronize with core 0 */
   RP2040_MulticoreSync(SIO->CPUID);
 
+#if (MAIN_RING_BENCHMARK == 1)
+  main_RingBenchConsumer();
+#endif
+
   while(1)
   {
     LED_GREEN_TOGGLE();
-    BlockingDelay(8000000);
+    BlockingDelay(main_u32BlinkDelay);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  main_ClockChanged function
+///
+/// \param  u32SysFreqHz : new clk_sys frequency (Hz)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void main_ClockChanged(uint32 u32SysFreqHz)
+{
+  /* 0: unknown frequency, keep the current period */
+  if(u32SysFreqHz != 0UL)
+  {
+    main_u32BlinkDelay = MAIN_BLINK_DELAY(u32SysFreqHz);
   }
 }
+
+#if (MAIN_RING_BENCHMARK == 1)
+//-----------------------------------------------------------------------------------------
+/// \brief  main_RingBenchProducer function (core 0)
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void main_RingBenchProducer(void)
+{
+  uint32 Sequence = 0UL;
+
+  while(Sequence < MAIN_BENCH_WORDS)
+  {
+    uint32* pSlots;
+    uint32 Reserved = RP2040_RingReserve(&main_BenchRing, &pSlots, MAIN_BENCH_BATCH);
+
+    if(Reserved == 0UL)
+    {
+      RP2040_RingWaitSpace(&main_BenchRing);
+      continue;
+    }
+
+    Reserved = (Reserved > (MAIN_BENCH_WORDS - Sequence)) ? (MAIN_BENCH_WORDS - Sequence) : Reserved;
+
+    /* Written in place (zero-copy) */
+    for(uint32 idx = 0UL; idx < Reserved; idx++)
+    {
+      pSlots[idx] = Sequence + idx;
+    }
+
+    RP2040_RingCommit(&main_BenchRing, Reserved);
+    Sequence += Reserved;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  main_RingBenchConsumer function (core 1)
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void main_RingBenchConsumer(void)
+{
+  uint32 Expected = 0UL;
+  uint32 Errors   = 0UL;
+  uint64 Start;
+  uint32 Duration;
+
+  RP2040_RingWaitData(&main_BenchRing);
+  Start = RP2040_TimerGetTime();
+
+  while(Expected < MAIN_BENCH_WORDS)
+  {
+    const uint32* pSlots;
+    const uint32 Available = RP2040_RingPeek(&main_BenchRing, &pSlots, MAIN_BENCH_BATCH);
+
+    if(Available == 0UL)
+    {
+      RP2040_RingWaitData(&main_BenchRing);
+      continue;
+    }
+
+    /* Read in place and check the sequence */
+    for(uint32 idx = 0UL; idx < Available; idx++)
+    {
+      Errors += (pSlots[idx] != (Expected + idx)) ? 1UL : 0UL;
+    }
+
+    RP2040_RingRelease(&main_BenchRing, Available);
+    Expected += Available;
+  }
+
+  Duration = (uint32)(RP2040_TimerGetTime() - Start);
+
+  main_RingBench.u32Words      = Expected;
+  main_RingBench.u32Errors     = Errors;
+  main_RingBench.u32DurationUs = Duration;
+  main_RingBench.u32WordsPerMs = (Duration != 0UL) ? (uint32)(((uint64)Expected * 1000ULL) / Duration) : 0UL;
+}
+#endif
@@ -19,6 +19,80 @@
 // Includes
 //=============================================================================
 #include "Clock.h"
+#include "Timer.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define CLOCK_PRESET(f, r, vsel)  { (f), (r), CLOCK_PLL_FBDIV_OF(f, r), CLOCK_PLL_POSTDIV1_OF(f, r), CLOCK_PLL_POSTDIV2_OF(f, r), (vsel) }
+
+/* CLK_SYS_SELECTED is one-hot on the SRC field */
+#define CLOCK_CLK_SYS_SELECTED_REF  (1UL << CLOCKS_CLK_SYS_CTRL_SRC_clk_ref)
+#define CLOCK_CLK_SYS_SELECTED_AUX  (1UL << CLOCKS_CLK_SYS_CTRL_SRC_clksrc_clk_sys_aux)
+
+/* CLK_REF_SELECTED is one-hot on the SRC field */
+#define CLOCK_CLK_REF_SELECTED_XOSC (1UL << CLOCKS_CLK_REF_CTRL_SRC_xosc_clksrc)
+
+#define CLOCK_ROSC_DIV_BOOST        (CLOCK_ROSC_DIV_PASS + CLOCK_ROSC_BOOST_DIV)
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+static uint32 RP2040_ClockGetSysPreset(void);
+static boolean RP2040_ClockPllSysConfig(const Clock_PresetType* pPreset);
+static void RP2040_ClockSetVoltage(uint32 VSel, boolean boSettle);
+static void RP2040_ClockSavePll(volatile PLL_SYS_Type* pPll, uint32* pSaved);
+static void RP2040_ClockRestorePll(volatile PLL_SYS_Type* pPll, const uint32* pSaved);
+static void RP2040_ClockRestoreAux(volatile uint32_t* pCtrl, volatile uint32_t* pDiv, uint32 Ctrl, uint32 Div);
+static void RP2040_ClockNotify(uint32 SysFreq);
+static uint32 RP2040_ClockGetRoscFreq(void);
+static boolean RP2040_ClockIsOnRosc(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+static const Clock_PresetType Clock_Presets[CLOCK_NB_OF_PRESETS] =
+{
+  CLOCK_PRESET(CLOCK_DFS_LOW_FREQ_HZ,   1UL,              CLOCK_DFS_LOW_VSEL),
+  CLOCK_PRESET(CLOCK_SYS_FREQ_HZ,       CLOCK_PLL_REFDIV, CLOCK_DFS_NOMINAL_VSEL),
+  CLOCK_PRESET(CLOCK_DFS_BOOST_FREQ_HZ, 1UL,              CLOCK_DFS_BOOST_VSEL)
+};
+
+/* Longest transition measured so far (us) */
+static volatile uint32 Clock_u32DfsMaxLatency;
+static volatile uint32 Clock_u32DfsOverruns;
+
+/* Clock-change notifiers (.bss: registered once the RAM is initialized) */
+static Clock_NotifierType Clock_Notifiers[CLOCK_NB_OF_NOTIFIERS];
+static uint32 Clock_u32NbOfNotifiers;
+
+/* Clocks of each gateable block */
+static const Clock_GateMapType Clock_GateMap[CLOCK_GATE_NB_OF_BLOCKS] =
+{
+  { CLOCK_GATE_ADC,      CLOCKS_WAKE_EN0_clk_sys_adc_Msk | CLOCKS_WAKE_EN0_clk_adc_adc_Msk,   0UL },
+  { CLOCK_GATE_DMA,      CLOCKS_WAKE_EN0_clk_sys_dma_Msk,                                     0UL },
+  { CLOCK_GATE_I2C0,     CLOCKS_WAKE_EN0_clk_sys_i2c0_Msk,                                    0UL },
+  { CLOCK_GATE_I2C1,     CLOCKS_WAKE_EN0_clk_sys_i2c1_Msk,                                    0UL },
+  { CLOCK_GATE_IO_BANK0, CLOCKS_WAKE_EN0_clk_sys_io_Msk | CLOCKS_WAKE_EN0_clk_sys_pads_Msk,   0UL },
+  { CLOCK_GATE_JTAG,     CLOCKS_WAKE_EN0_clk_sys_jtag_Msk,                                    0UL },
+  { CLOCK_GATE_PIO0,     CLOCKS_WAKE_EN0_clk_sys_pio0_Msk,                                    0UL },
+  { CLOCK_GATE_PIO1,     CLOCKS_WAKE_EN0_clk_sys_pio1_Msk,                                    0UL },
+  { CLOCK_GATE_PLL_USB,  CLOCKS_WAKE_EN0_clk_sys_pll_usb_Msk,                                 0UL },
+  { CLOCK_GATE_PWM,      CLOCKS_WAKE_EN0_clk_sys_pwm_Msk,                                     0UL },
+  { CLOCK_GATE_RTC,      CLOCKS_WAKE_EN0_clk_sys_rtc_Msk | CLOCKS_WAKE_EN0_clk_rtc_rtc_Msk,   0UL },
+  { CLOCK_GATE_SPI0,     CLOCKS_WAKE_EN0_clk_sys_spi0_Msk | CLOCKS_WAKE_EN0_clk_peri_spi0_Msk, 0UL },
+  { CLOCK_GATE_SPI1,     CLOCKS_WAKE_EN0_clk_sys_spi1_Msk | CLOCKS_WAKE_EN0_clk_peri_spi1_Msk, 0UL },
+  { CLOCK_GATE_SYSINFO,  0UL, CLOCKS_WAKE_EN1_clk_sys_sysinfo_Msk                                  },
+  { CLOCK_GATE_TBMAN,    0UL, CLOCKS_WAKE_EN1_clk_sys_tbman_Msk                                    },
+  { CLOCK_GATE_TIMER,    0UL, CLOCKS_WAKE_EN1_clk_sys_timer_Msk                                    },
+  { CLOCK_GATE_UART0,    0UL, CLOCKS_WAKE_EN1_clk_sys_uart0_Msk | CLOCKS_WAKE_EN1_clk_peri_uart0_Msk },
+  { CLOCK_GATE_UART1,    0UL, CLOCKS_WAKE_EN1_clk_sys_uart1_Msk | CLOCKS_WAKE_EN1_clk_peri_uart1_Msk },
+  { CLOCK_GATE_USB,      0UL, CLOCKS_WAKE_EN1_clk_sys_usbctrl_Msk | CLOCKS_WAKE_EN1_clk_usb_usbctrl_Msk }
+};
+
+/* Last profile programmed by RP2040_ClockGateApply */
+static Clock_GateProfileType Clock_GateProfile;
+static boolean Clock_boGateProfileApplied;
 
 
 //-----------------------------------------------------------------------------------------
@@ -30,31 +104,95 @@
 //-----------------------------------------------------------------------------------------
 void RP2040_ClockInit(void)
 {
-   /* Init the clock XOSC */
-   XOSC->STARTUP.bit.X4      = 1U;
-   XOSC->STARTUP.bit.DELAY   = 47U;
+   RP2040_ClockStartXosc();
+   RP2040_ClockStartPlls();
+   RP2040_ClockFinishInit();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockStartXosc function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   Does not wait for the crystal: the core keeps running on the ROSC until
+///         RP2040_ClockStartPlls.
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockStartXosc(void)
+{
+   /* Init the clock XOSC (startup delay solved at compile time for CLOCK_XOSC_STARTUP_US) */
+   XOSC->STARTUP.bit.X4      = CLOCK_XOSC_STARTUP_X4;
+   XOSC->STARTUP.bit.DELAY   = CLOCK_XOSC_STARTUP_DELAY;
    XOSC->CTRL.bit.FREQ_RANGE = XOSC_CTRL_FREQ_RANGE_1_15MHZ;
    XOSC->CTRL.bit.ENABLE     = XOSC_CTRL_ENABLE_ENABLE;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockStartPlls function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   Waits for the XOSC, then starts PLL_SYS and PLL_USB together so that their
+///         lock times overlap. Does not wait for the locks (RP2040_ClockFinishInit).
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockStartPlls(void)
+{
    while(XOSC->STATUS.bit.STABLE != 1U);
 
+   /* Move clk_ref from the ROSC to the XOSC (glitchless mux), undivided, the TIMER tick follows */
+   CLOCKS->CLK_REF_CTRL.bit.SRC = CLOCKS_CLK_REF_CTRL_SRC_xosc_clksrc;
+   while(CLOCKS->CLK_REF_SELECTED != CLOCK_CLK_REF_SELECTED_XOSC);
+   CLOCKS->CLK_REF_DIV.reg = 1UL << CLOCKS_CLK_REF_DIV_INT_Pos;
+   RP2040_TimerUpdateTick();
 
-  /* Release the reset of PLL_SYS */
+   /* Release the reset of PLL_SYS and PLL_USB */
    RESETS->RESET.bit.pll_sys = 0U;
-   while(RESETS->RESET_DONE.bit.pll_sys != 1);
+   RESETS->RESET.bit.pll_usb = 0U;
+   while((RESETS->RESET_DONE.bit.pll_sys != 1) || (RESETS->RESET_DONE.bit.pll_usb != 1));
 
-   /* Configure the PLL_SYS */
-   PLL_SYS->CS.bit.REFDIV           = 1U;
-   PLL_SYS->FBDIV_INT.bit.FBDIV_INT = 133U;
-   PLL_SYS->PRIM.bit.POSTDIV1       = 6U;
-   PLL_SYS->PRIM.bit.POSTDIV2       = 2U;
+   /* Configure the PLL_SYS (values solved at compile time for CLOCK_SYS_FREQ_HZ) */
+   PLL_SYS->CS.bit.REFDIV           = CLOCK_PLL_REFDIV;
+   PLL_SYS->FBDIV_INT.bit.FBDIV_INT = CLOCK_PLL_FBDIV;
+   PLL_SYS->PRIM.bit.POSTDIV1       = CLOCK_PLL_POSTDIV1;
+   PLL_SYS->PRIM.bit.POSTDIV2       = CLOCK_PLL_POSTDIV2;
 
    PLL_SYS->PWR.bit.PD        = 0U;
    PLL_SYS->PWR.bit.VCOPD     = 0U;
 
+   /* Configure the PLL_USB for 48 MHz */
+   PLL_USB->CS.bit.REFDIV           = 1U;
+   PLL_USB->FBDIV_INT.bit.FBDIV_INT = CLOCK_PLL_FBDIV_OF(CLOCK_USB_FREQ_HZ, 1UL);
+   PLL_USB->PRIM.bit.POSTDIV1       = CLOCK_PLL_POSTDIV1_OF(CLOCK_USB_FREQ_HZ, 1UL);
+   PLL_USB->PRIM.bit.POSTDIV2       = CLOCK_PLL_POSTDIV2_OF(CLOCK_USB_FREQ_HZ, 1UL);
+
+   PLL_USB->PWR.bit.PD        = 0U;
+   PLL_USB->PWR.bit.VCOPD     = 0U;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockFinishInit function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockFinishInit(void)
+{
+   /* Release reset on IO_BANK0 while the PLLs lock */
+   RESETS->RESET.bit.io_bank0 = 0U;
+
    while(PLL_SYS->CS.bit.LOCK != 1U);
 
    PLL_SYS->PWR.bit.POSTDIVPD = 0U;
 
+   /* Park clk_sys on clk_ref while the aux mux (not glitchless) changes: after
+      RP2040_ClockRoscBoost, clk_sys runs from the ROSC through the aux mux */
+   CLOCKS->CLK_SYS_CTRL.bit.SRC = CLOCKS_CLK_SYS_CTRL_SRC_clk_ref;
+   while(CLOCKS->CLK_SYS_SELECTED != CLOCK_CLK_SYS_SELECTED_REF);
+
    /* Switch the system clock to use the PLL */
    CLOCKS->CLK_SYS_CTRL.bit.AUXSRC = CLOCKS_CLK_SYS_CTRL_AUXSRC_clksrc_pll_sys;
    CLOCKS->CLK_SYS_CTRL.bit.SRC    = CLOCKS_CLK_SYS_CTRL_SRC_clksrc_clk_sys_aux;
@@ -63,13 +201,748 @@ void RP2040_ClockInit(void)
  
    while(CLOCKS->CLK_SYS_SELECTED == 0UL);
 
-   /* Enable clock for peripheral */
-   CLOCKS->CLK_PERI_CTRL.bit.ENABLE = 1U;
+   /* Back to the nominal ROSC frequency */
+   if((ROSC->DIV.reg & ROSC_DIV_DIV_Msk) == CLOCK_ROSC_DIV_BOOST)
+   {
+     ROSC->DIV.reg = CLOCK_ROSC_DIV_PASS + CLOCK_ROSC_DIV_DEFAULT;
+   }
+
+   while(PLL_USB->CS.bit.LOCK != 1U);
+
+   PLL_USB->PWR.bit.POSTDIVPD = 0U;
 
-   /* Release reset on IO_BANK0 */
-    RESETS->RESET.bit.io_bank0 = 0U;
+   /* The auxiliary muxes are not glitchless: each generator is stopped while its source changes
+      (they are all stopped after a reset) */
+
+   /* clk_usb and clk_adc from PLL_USB (48 MHz) */
+   CLOCKS->CLK_USB_CTRL.bit.ENABLE = 0U;
+   CLOCKS->CLK_USB_CTRL.bit.AUXSRC = CLOCKS_CLK_USB_CTRL_AUXSRC_clksrc_pll_usb;
+   CLOCKS->CLK_USB_DIV.bit.INT     = 1U;
+   CLOCKS->CLK_USB_CTRL.bit.ENABLE = 1U;
+
+   CLOCKS->CLK_ADC_CTRL.bit.ENABLE = 0U;
+   CLOCKS->CLK_ADC_CTRL.bit.AUXSRC = CLOCKS_CLK_ADC_CTRL_AUXSRC_clksrc_pll_usb;
+   CLOCKS->CLK_ADC_DIV.bit.INT     = 1U;
+   CLOCKS->CLK_ADC_CTRL.bit.ENABLE = 1U;
+
+   /* clk_peri from clk_sys (highest UART/SPI bit rates) */
+   CLOCKS->CLK_PERI_CTRL.bit.ENABLE = 0U;
+   CLOCKS->CLK_PERI_CTRL.bit.AUXSRC = CLOCKS_CLK_PERI_CTRL_AUXSRC_clk_sys;
+   CLOCKS->CLK_PERI_CTRL.bit.ENABLE = 1U;
 
     /* Wait for reset to be done */
     /* Release reset is done on IO_BANK0 */
     while(RESETS->RESET_DONE.bit.io_bank0 != 1);
 }
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockRoscBoost function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   Fast boot: clk_sys runs from the ROSC divided by CLOCK_ROSC_BOOST_DIV instead of 16,
+///         clk_ref stays close to its nominal frequency (TIMER tick). The switch to PLL_SYS is
+///         done later by RP2040_ClockPollDeferred/RP2040_ClockCompleteDeferred.
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockRoscBoost(void)
+{
+   /* Divide clk_ref first: it never runs faster than the boosted ROSC / CLOCK_ROSC_BOOST_REF_DIV */
+   CLOCKS->CLK_REF_DIV.reg = CLOCK_ROSC_BOOST_REF_DIV << CLOCKS_CLK_REF_DIV_INT_Pos;
+
+   ROSC->DIV.reg = CLOCK_ROSC_DIV_BOOST;
+
+   /* clk_sys from the ROSC through the aux mux (clk_sys is on clk_ref, the aux mux is free) */
+   CLOCKS->CLK_SYS_CTRL.bit.AUXSRC = CLOCKS_CLK_SYS_CTRL_AUXSRC_rosc_clksrc;
+   CLOCKS->CLK_SYS_CTRL.bit.SRC    = CLOCKS_CLK_SYS_CTRL_SRC_clksrc_clk_sys_aux;
+   while(CLOCKS->CLK_SYS_SELECTED != CLOCK_CLK_SYS_SELECTED_AUX);
+
+   RP2040_TimerUpdateTick();
+
+   /* Release reset on IO_BANK0 (the application may drive the pins before the PLL switch) */
+   RESETS->RESET.bit.io_bank0 = 0U;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockPollDeferred function
+///
+/// \param  void
+///
+/// \return TRUE once clk_sys runs from PLL_SYS (immediately after a normal boot)
+///
+/// \note   Non-blocking step of the deferred switch: starts the PLLs once the XOSC is stable,
+///         then switches clk_sys once they are locked and calls the clock-change notifiers.
+//-----------------------------------------------------------------------------------------
+boolean RP2040_ClockPollDeferred(void)
+{
+  uint32 Token;
+  boolean boDone = FALSE;
+
+  if(RP2040_ClockIsOnRosc() == FALSE)
+  {
+    return(TRUE);
+  }
+
+  Token = RP2040_SpinlockAcquire(CLOCK_DFS_SPINLOCK, TRUE);
+
+  /* Re-check under the lock, the other core may have completed the switch */
+  if(RP2040_ClockIsOnRosc() == FALSE)
+  {
+    boDone = TRUE;
+  }
+  else if(RESETS->RESET_DONE.bit.pll_sys == 0U)
+  {
+    if(XOSC->STATUS.bit.STABLE == 1U)
+    {
+      RP2040_ClockStartPlls();
+    }
+  }
+  else if((PLL_SYS->CS.bit.LOCK == 1U) && (PLL_USB->CS.bit.LOCK == 1U))
+  {
+    RP2040_ClockFinishInit();
+    RP2040_ClockNotify(RP2040_ClockGetSysFreq());
+    boDone = TRUE;
+  }
+  else
+  {
+    /* PLLs locking */
+  }
+
+  RP2040_SpinlockRelease(CLOCK_DFS_SPINLOCK, Token);
+
+  return(boDone);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockCompleteDeferred function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockCompleteDeferred(void)
+{
+  while(RP2040_ClockPollDeferred() == FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockSetSysPreset function
+///
+/// \param  Preset : CLOCK_PRESET_LOW, CLOCK_PRESET_NOMINAL or CLOCK_PRESET_BOOST
+///
+/// \return TRUE if clk_sys runs from the requested preset
+///
+/// \note   clk_sys is parked on clk_ref (glitchless mux) while PLL_SYS is reprogrammed.
+///         The voltage is raised before a frequency increase and lowered after a decrease.
+///         If PLL_SYS does not lock, the previous preset and voltage are restored and FALSE is returned.
+///         Callable from both cores, the transitions are serialized by a hardware spinlock.
+///         A transition longer than CLOCK_DFS_MAX_LATENCY_US is counted (RP2040_ClockGetDfsOverruns).
+//-----------------------------------------------------------------------------------------
+boolean RP2040_ClockSetSysPreset(uint32 Preset)
+{
+  const Clock_PresetType* pPreset;
+  boolean boResult = TRUE;
+  uint32 Token;
+  uint32 Current;
+  uint32 CurrentVSel;
+  uint32 SysFreq;
+  uint64 Start;
+
+  /* Not before the end of a fast ROSC boot (RP2040_ClockCompleteDeferred) */
+  if((Preset >= CLOCK_NB_OF_PRESETS) || (RP2040_ClockIsOnRosc() == TRUE))
+  {
+    return(FALSE);
+  }
+
+  /* The transition timeouts are measured with the TIMER */
+  if(RESETS->RESET_DONE.bit.timer == 0U)
+  {
+    RP2040_TimerInit();
+  }
+
+  /* Take the DFS lock with the interrupts masked, the lock holder must not be preempted */
+  Token = RP2040_SpinlockAcquire(CLOCK_DFS_SPINLOCK, TRUE);
+
+  Start   = RP2040_TimerGetTime();
+  Current = RP2040_ClockGetSysPreset();
+  SysFreq = RP2040_ClockGetSysFreq();
+
+  if(Current != Preset)
+  {
+    pPreset     = &Clock_Presets[Preset];
+    CurrentVSel = VREG_AND_CHIP_RESET->VREG.bit.VSEL;
+
+    /* Faster: raise the voltage first */
+    if(pPreset->u32VSel > CurrentVSel)
+    {
+      RP2040_ClockSetVoltage(pPreset->u32VSel, TRUE);
+    }
+
+    /* Park clk_sys on clk_ref */
+    CLOCKS->CLK_SYS_CTRL.bit.SRC = CLOCKS_CLK_SYS_CTRL_SRC_clk_ref;
+    while(CLOCKS->CLK_SYS_SELECTED != CLOCK_CLK_SYS_SELECTED_REF);
+
+    if(RP2040_ClockPllSysConfig(pPreset) == FALSE)
+    {
+      boResult = FALSE;
+
+      /* Restore the previous setting, stay on clk_ref if it does not lock either */
+      pPreset = (Current < CLOCK_NB_OF_PRESETS) ? &Clock_Presets[Current] : NULL_PTR;
+
+      if((pPreset != NULL_PTR) && (RP2040_ClockPllSysConfig(pPreset) == FALSE))
+      {
+        pPreset = NULL_PTR;
+      }
+    }
+
+    if(pPreset != NULL_PTR)
+    {
+      /* Back on PLL_SYS (AUXSRC is still clksrc_pll_sys) */
+      CLOCKS->CLK_SYS_CTRL.bit.SRC = CLOCKS_CLK_SYS_CTRL_SRC_clksrc_clk_sys_aux;
+      while(CLOCKS->CLK_SYS_SELECTED != CLOCK_CLK_SYS_SELECTED_AUX);
+
+      /* Slower: lower the voltage last */
+      if(pPreset->u32VSel < CurrentVSel)
+      {
+        RP2040_ClockSetVoltage(pPreset->u32VSel, FALSE);
+      }
+    }
+
+    /* Failed: clk_sys is back on the previous preset (or on clk_ref), so is the voltage */
+    if((boResult == FALSE) && (VREG_AND_CHIP_RESET->VREG.bit.VSEL != CurrentVSel))
+    {
+      RP2040_ClockSetVoltage(CurrentVSel, FALSE);
+    }
+
+    /* The transition ends here, the notifiers are not part of CLOCK_DFS_MAX_LATENCY_US */
+    const uint32 Latency = (uint32)(RP2040_TimerGetTime() - Start);
+
+    if(Latency > Clock_u32DfsMaxLatency)
+    {
+      Clock_u32DfsMaxLatency = Latency;
+    }
+
+    if(Latency > CLOCK_DFS_MAX_LATENCY_US)
+    {
+      Clock_u32DfsOverruns++;
+    }
+
+    /* Let the drivers rescale while the lock is held (no clock use in between) */
+    if(RP2040_ClockGetSysFreq() != SysFreq)
+    {
+      RP2040_ClockNotify(RP2040_ClockGetSysFreq());
+    }
+  }
+
+  /* Release the DFS lock */
+  RP2040_SpinlockRelease(CLOCK_DFS_SPINLOCK, Token);
+
+  return(boResult);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockRegisterNotifier function
+///
+/// \param  pNotifier : called with the new clk_sys frequency after each change
+///
+/// \return TRUE if registered, FALSE if the registry is full
+///
+/// \note   The notifier is called once at registration with the current frequency, then
+///         on the core that changes clk_sys, with the interrupts masked and the clock lock
+///         held: it must only recompute its dividers/reloads and must not call the Clock API
+///         (its cost is not part of CLOCK_DFS_MAX_LATENCY_US but delays the other core).
+///         The resources private to the other core (SysTick, NVIC) are not reachable from
+///         there: their driver records the frequency and lets that core apply it.
+///         Register after the RAM initialization (the registry lives in .bss).
+//-----------------------------------------------------------------------------------------
+boolean RP2040_ClockRegisterNotifier(Clock_NotifierType pNotifier)
+{
+  boolean boResult = FALSE;
+  uint32 Token;
+
+  if(pNotifier == NULL_PTR)
+  {
+    return(FALSE);
+  }
+
+  Token = RP2040_SpinlockAcquire(CLOCK_DFS_SPINLOCK, TRUE);
+
+  if(Clock_u32NbOfNotifiers < CLOCK_NB_OF_NOTIFIERS)
+  {
+    Clock_Notifiers[Clock_u32NbOfNotifiers] = pNotifier;
+    Clock_u32NbOfNotifiers++;
+
+    pNotifier(RP2040_ClockGetSysFreq());
+    boResult = TRUE;
+  }
+
+  RP2040_SpinlockRelease(CLOCK_DFS_SPINLOCK, Token);
+
+  return(boResult);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGateBuildProfile function
+///
+/// \param  SleepBlocks : CLOCK_GATE_xxx blocks that keep running in sleep
+///         pProfile    : built profile
+///
+/// \return void
+///
+/// \note   The running profile enables the base clocks and the clocks of every block whose
+///         reset is released. Rebuild and apply it after initializing another driver.
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockGateBuildProfile(uint32 SleepBlocks, Clock_GateProfileType* pProfile)
+{
+  const uint32 UsedBlocks = RESETS->RESET_DONE.reg;
+
+  if(pProfile == NULL_PTR)
+  {
+    return;
+  }
+
+  pProfile->u32WakeEn0  = CLOCK_GATE_BASE_EN0;
+  pProfile->u32WakeEn1  = CLOCK_GATE_BASE_EN1;
+  pProfile->u32SleepEn0 = 0UL;
+  pProfile->u32SleepEn1 = 0UL;
+
+  for(uint32 Index = 0UL; Index < CLOCK_GATE_NB_OF_BLOCKS; Index++)
+  {
+    const Clock_GateMapType* const pMap = &Clock_GateMap[Index];
+
+    if((UsedBlocks & pMap->u32Block) != 0UL)
+    {
+      pProfile->u32WakeEn0 |= pMap->u32En0;
+      pProfile->u32WakeEn1 |= pMap->u32En1;
+    }
+
+    if((SleepBlocks & pMap->u32Block) != 0UL)
+    {
+      pProfile->u32SleepEn0 |= pMap->u32En0;
+      pProfile->u32SleepEn1 |= pMap->u32En1;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGateApply function
+///
+/// \param  pProfile : profile to program into WAKE_EN0/1 and SLEEP_EN0/1
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockGateApply(const Clock_GateProfileType* pProfile)
+{
+  uint32 Token;
+
+  if(pProfile == NULL_PTR)
+  {
+    return;
+  }
+
+  Token = RP2040_SpinlockAcquire(CLOCK_DFS_SPINLOCK, TRUE);
+
+  CLOCKS->WAKE_EN0.reg  = pProfile->u32WakeEn0;
+  CLOCKS->WAKE_EN1.reg  = pProfile->u32WakeEn1;
+  CLOCKS->SLEEP_EN0.reg = pProfile->u32SleepEn0;
+  CLOCKS->SLEEP_EN1.reg = pProfile->u32SleepEn1;
+
+  Clock_GateProfile          = *pProfile;
+  Clock_boGateProfileApplied = TRUE;
+
+  RP2040_SpinlockRelease(CLOCK_DFS_SPINLOCK, Token);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGateGetProfile function
+///
+/// \param  pProfile : copy of the applied profile
+///
+/// \return TRUE if a profile has been applied (the reset value keeps every clock enabled)
+//-----------------------------------------------------------------------------------------
+boolean RP2040_ClockGateGetProfile(Clock_GateProfileType* pProfile)
+{
+  if((pProfile == NULL_PTR) || (Clock_boGateProfileApplied == FALSE))
+  {
+    return(FALSE);
+  }
+
+  *pProfile = Clock_GateProfile;
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGetSysFreq function
+///
+/// \param  void
+///
+/// \return current clk_sys frequency in Hz (0 if PLL_SYS runs outside of the presets)
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_ClockGetSysFreq(void)
+{
+  if(CLOCKS->CLK_SYS_SELECTED == CLOCK_CLK_SYS_SELECTED_REF)
+  {
+    return(RP2040_ClockGetFreq(CLOCK_ID_REF));
+  }
+
+  if(RP2040_ClockIsOnRosc() == TRUE)
+  {
+    return(RP2040_ClockGetRoscFreq());
+  }
+
+  const uint32 Preset = RP2040_ClockGetSysPreset();
+
+  return((Preset < CLOCK_NB_OF_PRESETS) ? Clock_Presets[Preset].u32FreqHz : 0UL);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGetFreq function
+///
+/// \param  ClockId : CLOCK_ID_xxx
+///
+/// \return current frequency of the clock in Hz (0 if stopped or unknown)
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_ClockGetFreq(uint32 ClockId)
+{
+  uint32 Freq = 0UL;
+
+  switch(ClockId)
+  {
+    case CLOCK_ID_REF:
+      Freq  = (CLOCKS->CLK_REF_SELECTED == CLOCK_CLK_REF_SELECTED_XOSC) ? CLOCK_XOSC_FREQ_HZ : RP2040_ClockGetRoscFreq();
+      Freq /= (CLOCKS->CLK_REF_DIV.bit.INT != 0U) ? (uint32)CLOCKS->CLK_REF_DIV.bit.INT : 1UL;
+      break;
+
+    case CLOCK_ID_SYS:
+      Freq = RP2040_ClockGetSysFreq();
+      break;
+
+    case CLOCK_ID_PERI:
+      Freq = (CLOCKS->CLK_PERI_CTRL.bit.ENABLE == 1U) ? RP2040_ClockGetSysFreq() : 0UL;
+      break;
+
+    case CLOCK_ID_USB:
+      Freq = (CLOCKS->CLK_USB_CTRL.bit.ENABLE == 1U) ? CLOCK_USB_FREQ_HZ : 0UL;
+      break;
+
+    case CLOCK_ID_ADC:
+      Freq = (CLOCKS->CLK_ADC_CTRL.bit.ENABLE == 1U) ? CLOCK_USB_FREQ_HZ : 0UL;
+      break;
+
+    default:
+      break;
+  }
+
+  return(Freq);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGetDfsMaxLatency function
+///
+/// \param  void
+///
+/// \return longest preset transition measured so far (us), without the notifiers
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_ClockGetDfsMaxLatency(void)
+{
+  return(Clock_u32DfsMaxLatency);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGetDfsOverruns function
+///
+/// \param  void
+///
+/// \return number of preset transitions that took longer than CLOCK_DFS_MAX_LATENCY_US
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_ClockGetDfsOverruns(void)
+{
+  return(Clock_u32DfsOverruns);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockSaveConfig function
+///
+/// \param  pConfig : snapshot of the clock tree
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockSaveConfig(Clock_ConfigType* pConfig)
+{
+  pConfig->u32XoscCtrl = XOSC->CTRL.reg;
+  pConfig->u32RoscCtrl = ROSC->CTRL.reg;
+
+  RP2040_ClockSavePll(PLL_SYS, &pConfig->u32PllSys[0]);
+  RP2040_ClockSavePll(PLL_USB, &pConfig->u32PllUsb[0]);
+
+  pConfig->u32RefCtrl  = CLOCKS->CLK_REF_CTRL.reg;
+  pConfig->u32RefDiv   = CLOCKS->CLK_REF_DIV.reg;
+  pConfig->u32SysCtrl  = CLOCKS->CLK_SYS_CTRL.reg;
+  pConfig->u32SysDiv   = CLOCKS->CLK_SYS_DIV.reg;
+  pConfig->u32PeriCtrl = CLOCKS->CLK_PERI_CTRL.reg;
+  pConfig->u32UsbCtrl  = CLOCKS->CLK_USB_CTRL.reg;
+  pConfig->u32UsbDiv   = CLOCKS->CLK_USB_DIV.reg;
+  pConfig->u32AdcCtrl  = CLOCKS->CLK_ADC_CTRL.reg;
+  pConfig->u32AdcDiv   = CLOCKS->CLK_ADC_DIV.reg;
+  pConfig->u32RtcCtrl  = CLOCKS->CLK_RTC_CTRL.reg;
+  pConfig->u32RtcDiv   = CLOCKS->CLK_RTC_DIV.reg;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockRestoreConfig function
+///
+/// \param  pConfig : snapshot taken by RP2040_ClockSaveConfig
+///
+/// \return void
+///
+/// \note   Same order as RP2040_ClockInit: XOSC, clk_ref, PLLs, clk_sys, then the
+///         auxiliary generators. clk_sys runs from clk_ref while the PLLs are restored.
+//-----------------------------------------------------------------------------------------
+void RP2040_ClockRestoreConfig(const Clock_ConfigType* pConfig)
+{
+  /* XOSC and ROSC (either one may have been disabled for the dormant mode) */
+  XOSC->CTRL.reg = pConfig->u32XoscCtrl;
+  ROSC->CTRL.reg = pConfig->u32RoscCtrl;
+
+  if(((pConfig->u32XoscCtrl & XOSC_CTRL_ENABLE_Msk) >> XOSC_CTRL_ENABLE_Pos) == (uint32)XOSC_CTRL_ENABLE_ENABLE)
+  {
+    while(XOSC->STATUS.bit.STABLE != 1U);
+  }
+
+  /* Any ENABLE code other than DISABLE runs the ROSC */
+  if(((pConfig->u32RoscCtrl & ROSC_CTRL_ENABLE_Msk) >> ROSC_CTRL_ENABLE_Pos) != (uint32)ROSC_CTRL_ENABLE_DISABLE)
+  {
+    while(ROSC->STATUS.bit.STABLE != 1U);
+  }
+
+  /* clk_ref (glitchless mux) */
+  CLOCKS->CLK_REF_DIV.reg  = pConfig->u32RefDiv;
+  CLOCKS->CLK_REF_CTRL.reg = pConfig->u32RefCtrl;
+  while(CLOCKS->CLK_REF_SELECTED != (1UL << (pConfig->u32RefCtrl & CLOCKS_CLK_REF_CTRL_SRC_Msk)));
+  RP2040_TimerUpdateTick();
+
+  /* Park clk_sys on clk_ref while its auxiliary source is restored */
+  CLOCKS->CLK_SYS_CTRL.bit.SRC = CLOCKS_CLK_SYS_CTRL_SRC_clk_ref;
+  while(CLOCKS->CLK_SYS_SELECTED != CLOCK_CLK_SYS_SELECTED_REF);
+
+  RP2040_ClockRestorePll(PLL_SYS, &pConfig->u32PllSys[0]);
+  RP2040_ClockRestorePll(PLL_USB, &pConfig->u32PllUsb[0]);
+
+  CLOCKS->CLK_SYS_DIV.reg  = pConfig->u32SysDiv;
+  CLOCKS->CLK_SYS_CTRL.reg = pConfig->u32SysCtrl & ~CLOCKS_CLK_SYS_CTRL_SRC_Msk;
+  CLOCKS->CLK_SYS_CTRL.reg = pConfig->u32SysCtrl;
+  while(CLOCKS->CLK_SYS_SELECTED != (1UL << (pConfig->u32SysCtrl & CLOCKS_CLK_SYS_CTRL_SRC_Msk)));
+
+  /* Auxiliary generators (clk_peri has no divider) */
+  RP2040_ClockRestoreAux(&CLOCKS->CLK_PERI_CTRL.reg, NULL_PTR,                pConfig->u32PeriCtrl, 0UL);
+  RP2040_ClockRestoreAux(&CLOCKS->CLK_USB_CTRL.reg,  &CLOCKS->CLK_USB_DIV.reg, pConfig->u32UsbCtrl,  pConfig->u32UsbDiv);
+  RP2040_ClockRestoreAux(&CLOCKS->CLK_ADC_CTRL.reg,  &CLOCKS->CLK_ADC_DIV.reg, pConfig->u32AdcCtrl,  pConfig->u32AdcDiv);
+  RP2040_ClockRestoreAux(&CLOCKS->CLK_RTC_CTRL.reg,  &CLOCKS->CLK_RTC_DIV.reg, pConfig->u32RtcCtrl,  pConfig->u32RtcDiv);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGetSysPreset function
+///
+/// \param  void
+///
+/// \return preset currently driving clk_sys (CLOCK_NB_OF_PRESETS if none)
+///
+/// \note   Decoded from the PLL_SYS registers, so it also holds after a warm restart.
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_ClockGetSysPreset(void)
+{
+  uint32 Preset;
+
+  if(CLOCKS->CLK_SYS_SELECTED != CLOCK_CLK_SYS_SELECTED_AUX)
+  {
+    return(CLOCK_NB_OF_PRESETS);
+  }
+
+  for(Preset = 0UL; Preset < CLOCK_NB_OF_PRESETS; Preset++)
+  {
+    if((PLL_SYS->CS.bit.REFDIV           == Clock_Presets[Preset].u32RefDiv)   &&
+       (PLL_SYS->FBDIV_INT.bit.FBDIV_INT == Clock_Presets[Preset].u32FbDiv)    &&
+       (PLL_SYS->PRIM.bit.POSTDIV1       == Clock_Presets[Preset].u32PostDiv1) &&
+       (PLL_SYS->PRIM.bit.POSTDIV2       == Clock_Presets[Preset].u32PostDiv2))
+    {
+      break;
+    }
+  }
+
+  return(Preset);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockPllSysConfig function
+///
+/// \param  pPreset : PLL_SYS setting to apply (clk_sys must not run from PLL_SYS)
+///
+/// \return TRUE if PLL_SYS locked within CLOCK_PLL_LOCK_TIMEOUT_US
+//-----------------------------------------------------------------------------------------
+static boolean RP2040_ClockPllSysConfig(const Clock_PresetType* pPreset)
+{
+  /* Power down the PLL before changing the dividers */
+  PLL_SYS->PWR.bit.POSTDIVPD = 1U;
+  PLL_SYS->PWR.bit.VCOPD     = 1U;
+  PLL_SYS->PWR.bit.PD        = 1U;
+
+  PLL_SYS->CS.reg        = (PLL_SYS->CS.reg & ~PLL_SYS_CS_REFDIV_Msk) | (pPreset->u32RefDiv << PLL_SYS_CS_REFDIV_Pos);
+  PLL_SYS->FBDIV_INT.reg = pPreset->u32FbDiv;
+  PLL_SYS->PRIM.reg      = (pPreset->u32PostDiv1 << PLL_SYS_PRIM_POSTDIV1_Pos) | (pPreset->u32PostDiv2 << PLL_SYS_PRIM_POSTDIV2_Pos);
+
+  PLL_SYS->PWR.bit.PD        = 0U;
+  PLL_SYS->PWR.bit.VCOPD     = 0U;
+
+  const uint64 Deadline = RP2040_TimerGetTime() + CLOCK_PLL_LOCK_TIMEOUT_US;
+
+  while((PLL_SYS->CS.bit.LOCK != 1U) && (RP2040_TimerGetTime() < Deadline));
+
+  if(PLL_SYS->CS.bit.LOCK != 1U)
+  {
+    return(FALSE);
+  }
+
+  PLL_SYS->PWR.bit.POSTDIVPD = 0U;
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockSetVoltage function
+///
+/// \param  VSel     : VREG output voltage (CLOCK_VREG_VSEL_xxx)
+///         boSettle : wait CLOCK_VREG_SETTLE_US for the new voltage
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_ClockSetVoltage(uint32 VSel, boolean boSettle)
+{
+  VREG_AND_CHIP_RESET->VREG.reg = (VREG_AND_CHIP_RESET->VREG.reg & ~VREG_AND_CHIP_RESET_VREG_VSEL_Msk) | (VSel << VREG_AND_CHIP_RESET_VREG_VSEL_Pos);
+
+  if(boSettle == TRUE)
+  {
+    /* There is no "voltage reached" flag (ROK only reports regulation), wait for the settle time */
+    const uint64 Deadline = RP2040_TimerGetTime() + CLOCK_VREG_SETTLE_US;
+
+    while(RP2040_TimerGetTime() < Deadline);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockSavePll function
+///
+/// \param  pPll   : PLL_SYS or PLL_USB
+///         pSaved : CS, PWR, FBDIV_INT and PRIM
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_ClockSavePll(volatile PLL_SYS_Type* pPll, uint32* pSaved)
+{
+  pSaved[0] = pPll->CS.reg;
+  pSaved[1] = pPll->PWR.reg;
+  pSaved[2] = pPll->FBDIV_INT.reg;
+  pSaved[3] = pPll->PRIM.reg;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockRestorePll function
+///
+/// \param  pPll   : PLL_SYS or PLL_USB (must not drive any clock)
+///         pSaved : CS, PWR, FBDIV_INT and PRIM
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_ClockRestorePll(volatile PLL_SYS_Type* pPll, const uint32* pSaved)
+{
+  /* Program the dividers with the PLL powered down */
+  pPll->PWR.reg       = PLL_SYS_PWR_PD_Msk | PLL_SYS_PWR_DSMPD_Msk | PLL_SYS_PWR_POSTDIVPD_Msk | PLL_SYS_PWR_VCOPD_Msk;
+  pPll->CS.reg        = pSaved[0] & PLL_SYS_CS_REFDIV_Msk;
+  pPll->FBDIV_INT.reg = pSaved[2];
+  pPll->PRIM.reg      = pSaved[3];
+
+  if((pSaved[1] & PLL_SYS_PWR_PD_Msk) == 0UL)
+  {
+    /* The PLL was running: power the VCO, wait for the lock, then the post dividers */
+    pPll->PWR.reg = pSaved[1] | PLL_SYS_PWR_POSTDIVPD_Msk;
+
+    while(pPll->CS.bit.LOCK != 1U);
+
+    pPll->PWR.reg = pSaved[1];
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockRestoreAux function
+///
+/// \param  pCtrl : CLK_xxx_CTRL register
+///         pDiv  : CLK_xxx_DIV register (NULL_PTR: none)
+///         Ctrl  : saved CTRL value
+///         Div   : saved DIV value
+///
+/// \return void
+///
+/// \note   The auxiliary mux is not glitchless, the generator is stopped during the change.
+//-----------------------------------------------------------------------------------------
+static void RP2040_ClockRestoreAux(volatile uint32_t* pCtrl, volatile uint32_t* pDiv, uint32 Ctrl, uint32 Div)
+{
+  *pCtrl &= ~CLOCKS_CLK_PERI_CTRL_ENABLE_Msk;
+
+  if(pDiv != NULL_PTR)
+  {
+    *pDiv = Div;
+  }
+
+  *pCtrl = Ctrl & ~CLOCKS_CLK_PERI_CTRL_ENABLE_Msk;
+  *pCtrl = Ctrl;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockNotify function
+///
+/// \param  SysFreq : new clk_sys frequency (Hz)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_ClockNotify(uint32 SysFreq)
+{
+  for(uint32 Index = 0UL; Index < Clock_u32NbOfNotifiers; Index++)
+  {
+    Clock_Notifiers[Index](SysFreq);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockGetRoscFreq function
+///
+/// \param  void
+///
+/// \return nominal ROSC output frequency for the current divider (Hz)
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_ClockGetRoscFreq(void)
+{
+  const uint32 Div = ROSC->DIV.reg & ROSC_DIV_DIV_Msk;
+
+  /* Not written since reset: default divider */
+  if(Div < CLOCK_ROSC_DIV_PASS)
+  {
+    return(CLOCK_ROSC_FREQ_HZ);
+  }
+
+  /* DIV = PASS + n, PASS alone divides by 32 */
+  return((CLOCK_ROSC_FREQ_HZ * CLOCK_ROSC_DIV_DEFAULT) / ((Div == CLOCK_ROSC_DIV_PASS) ? 32UL : (Div - CLOCK_ROSC_DIV_PASS)));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockIsOnRosc function
+///
+/// \param  void
+///
+/// \return TRUE if clk_sys runs from the ROSC through the aux mux (fast boot)
+//-----------------------------------------------------------------------------------------
+static boolean RP2040_ClockIsOnRosc(void)
+{
+  return(((CLOCKS->CLK_SYS_SELECTED == CLOCK_CLK_SYS_SELECTED_AUX) &&
+          (CLOCKS->CLK_SYS_CTRL.bit.AUXSRC == CLOCKS_CLK_SYS_CTRL_AUXSRC_rosc_clksrc)) ? TRUE : FALSE);
+}
@@ -22,13 +22,329 @@
 //=============================================================================
 #include "RP2040.h"
 #include "Platform_Types.h"
+#include "Spinlock.h"
 
+//=============================================================================
+// Configuration
+//=============================================================================
+/* Crystal frequency of the board (Pico: 12 MHz) */
+#ifndef CLOCK_XOSC_FREQ_HZ
+  #define CLOCK_XOSC_FREQ_HZ         12000000UL
+#endif
+
+/* Target clk_sys frequency, the single frequency constant used by all timing code
+   (e.g. make build DEFS="-DCLOCK_SYS_FREQ_HZ=250000000UL") */
+#ifndef CLOCK_SYS_FREQ_HZ
+  #define CLOCK_SYS_FREQ_HZ          133000000UL
+#endif
+
+#define CLOCK_SYS_FREQ_MHZ           (CLOCK_SYS_FREQ_HZ / 1000000UL)
+
+/* XOSC startup delay: the measured stabilization time of the crystal plus margin
+   (Pico crystal: well below 1 ms). XOSC STABLE is raised after DELAY x 256 cycles,
+   x 4 when DELAY alone does not fit its 14 bits */
+#ifndef CLOCK_XOSC_STARTUP_US
+  #define CLOCK_XOSC_STARTUP_US      1000UL
+#endif
+
+#define CLOCK_XOSC_STARTUP_CYCLES    (CLOCK_XOSC_STARTUP_US * (CLOCK_XOSC_FREQ_HZ / 1000000UL))
+#define CLOCK_XOSC_DELAY_MAX         0x3FFFUL
+
+#if (((CLOCK_XOSC_STARTUP_CYCLES + 255UL) / 256UL) <= CLOCK_XOSC_DELAY_MAX)
+  #define CLOCK_XOSC_STARTUP_X4      0UL
+  #define CLOCK_XOSC_STARTUP_DELAY   ((CLOCK_XOSC_STARTUP_CYCLES + 255UL) / 256UL)
+#elif (((CLOCK_XOSC_STARTUP_CYCLES + 1023UL) / 1024UL) <= CLOCK_XOSC_DELAY_MAX)
+  #define CLOCK_XOSC_STARTUP_X4      1UL
+  #define CLOCK_XOSC_STARTUP_DELAY   ((CLOCK_XOSC_STARTUP_CYCLES + 1023UL) / 1024UL)
+#else
+  #error "CLOCK_XOSC_STARTUP_US is out of the XOSC startup counter range"
+#endif
+
+/* PLL_USB output, drives clk_usb and clk_adc */
+#define CLOCK_USB_FREQ_HZ            48000000UL
+
+/* Nominal ROSC frequency (clk_ref until RP2040_ClockInit moves it to the XOSC) */
+#define CLOCK_ROSC_FREQ_HZ           6000000UL
+
+/* ROSC output divider: the reset divider is 16, RP2040_ClockRoscBoost lowers it to
+   CLOCK_ROSC_BOOST_DIV (2: nominal 48 MHz, 96 MHz at the fastest corner) */
+#define CLOCK_ROSC_DIV_PASS          0xAA0UL
+#define CLOCK_ROSC_DIV_DEFAULT       16UL
+
+#ifndef CLOCK_ROSC_BOOST_DIV
+  #define CLOCK_ROSC_BOOST_DIV       2UL
+#endif
+
+#if (CLOCK_ROSC_BOOST_DIV < 2UL) || (CLOCK_ROSC_BOOST_DIV > CLOCK_ROSC_DIV_DEFAULT)
+  #error "CLOCK_ROSC_BOOST_DIV must be in 2..16"
+#endif
+
+/* clk_ref divider while the ROSC is boosted (2-bit divider: at most 3) */
+#define CLOCK_ROSC_BOOST_REF_DIV     (((CLOCK_ROSC_DIV_DEFAULT / CLOCK_ROSC_BOOST_DIV) > 3UL) ? 3UL : (CLOCK_ROSC_DIV_DEFAULT / CLOCK_ROSC_BOOST_DIV))
+
+/* Clocks reported by RP2040_ClockGetFreq */
+#define CLOCK_ID_REF                 0UL
+#define CLOCK_ID_SYS                 1UL
+#define CLOCK_ID_PERI                2UL
+#define CLOCK_ID_USB                 3UL
+#define CLOCK_ID_ADC                 4UL
+
+//=============================================================================
+// PLL solver (evaluated at compile time)
+//=============================================================================
+/* PLL limits (RP2040 datasheet, 2.18.2) */
+#define CLOCK_PLL_REF_MIN_HZ         5000000ULL
+#define CLOCK_PLL_VCO_MIN_HZ         750000000ULL
+#define CLOCK_PLL_VCO_MAX_HZ         1600000000ULL
+#define CLOCK_PLL_FBDIV_MIN          16ULL
+#define CLOCK_PLL_FBDIV_MAX          320ULL
+
+#define CLOCK_PLL_REF_HZ(r)            ((CLOCK_XOSC_FREQ_HZ * 1ULL) / (r))
+#define CLOCK_PLL_VCO_HZ(f, pd1, pd2)  (((f) * 1ULL) * (pd1) * (pd2))
+
+/* REFDIV r with POSTDIV1 pd1 and POSTDIV2 pd2 produce exactly the frequency f */
+#define CLOCK_PLL_VALID(f, r, pd1, pd2) (((CLOCK_XOSC_FREQ_HZ % (r)) == 0ULL)                                           && \
+                                         (CLOCK_PLL_REF_HZ(r) >= CLOCK_PLL_REF_MIN_HZ)                                  && \
+                                         ((CLOCK_PLL_VCO_HZ(f, pd1, pd2) % CLOCK_PLL_REF_HZ(r)) == 0ULL)                && \
+                                         (CLOCK_PLL_VCO_HZ(f, pd1, pd2) >= CLOCK_PLL_VCO_MIN_HZ)                        && \
+                                         (CLOCK_PLL_VCO_HZ(f, pd1, pd2) <= CLOCK_PLL_VCO_MAX_HZ)                        && \
+                                         ((CLOCK_PLL_VCO_HZ(f, pd1, pd2) / CLOCK_PLL_REF_HZ(r)) >= CLOCK_PLL_FBDIV_MIN) && \
+                                         ((CLOCK_PLL_VCO_HZ(f, pd1, pd2) / CLOCK_PLL_REF_HZ(r)) <= CLOCK_PLL_FBDIV_MAX))
+
+/* Post dividers generating f with REFDIV r, encoded as 0x<POSTDIV1><POSTDIV2> (0: no solution).
+   Candidates are ordered by decreasing VCO frequency (lowest jitter) */
+#define CLOCK_PLL_SOLVE(f, r)            (CLOCK_PLL_VALID(f, r, 7, 7) ? 0x77U : \
+                                          CLOCK_PLL_VALID(f, r, 7, 6) ? 0x76U : \
+                                          CLOCK_PLL_VALID(f, r, 6, 6) ? 0x66U : \
+                                          CLOCK_PLL_VALID(f, r, 7, 5) ? 0x75U : \
+                                          CLOCK_PLL_VALID(f, r, 6, 5) ? 0x65U : \
+                                          CLOCK_PLL_VALID(f, r, 7, 4) ? 0x74U : \
+                                          CLOCK_PLL_VALID(f, r, 5, 5) ? 0x55U : \
+                                          CLOCK_PLL_VALID(f, r, 6, 4) ? 0x64U : \
+                                          CLOCK_PLL_VALID(f, r, 7, 3) ? 0x73U : \
+                                          CLOCK_PLL_VALID(f, r, 5, 4) ? 0x54U : \
+                                          CLOCK_PLL_VALID(f, r, 6, 3) ? 0x63U : \
+                                          CLOCK_PLL_VALID(f, r, 4, 4) ? 0x44U : \
+                                          CLOCK_PLL_VALID(f, r, 5, 3) ? 0x53U : \
+                                          CLOCK_PLL_VALID(f, r, 7, 2) ? 0x72U : \
+                                          CLOCK_PLL_VALID(f, r, 6, 2) ? 0x62U : \
+                                          CLOCK_PLL_VALID(f, r, 4, 3) ? 0x43U : \
+                                          CLOCK_PLL_VALID(f, r, 5, 2) ? 0x52U : \
+                                          CLOCK_PLL_VALID(f, r, 3, 3) ? 0x33U : \
+                                          CLOCK_PLL_VALID(f, r, 4, 2) ? 0x42U : \
+                                          CLOCK_PLL_VALID(f, r, 7, 1) ? 0x71U : \
+                                          CLOCK_PLL_VALID(f, r, 6, 1) ? 0x61U : \
+                                          CLOCK_PLL_VALID(f, r, 3, 2) ? 0x32U : \
+                                          CLOCK_PLL_VALID(f, r, 5, 1) ? 0x51U : \
+                                          CLOCK_PLL_VALID(f, r, 4, 1) ? 0x41U : \
+                                          CLOCK_PLL_VALID(f, r, 2, 2) ? 0x22U : \
+                                          CLOCK_PLL_VALID(f, r, 3, 1) ? 0x31U : \
+                                          CLOCK_PLL_VALID(f, r, 2, 1) ? 0x21U : \
+                                          CLOCK_PLL_VALID(f, r, 1, 1) ? 0x11U : \
+                                          0U)
+
+/* The smallest REFDIV is preferred (highest phase detector frequency) */
+#if   (CLOCK_PLL_SOLVE(CLOCK_SYS_FREQ_HZ, 1) != 0)
+  #define CLOCK_PLL_REFDIV           1UL
+#elif (CLOCK_PLL_SOLVE(CLOCK_SYS_FREQ_HZ, 2) != 0)
+  #define CLOCK_PLL_REFDIV           2UL
+#elif (CLOCK_PLL_SOLVE(CLOCK_SYS_FREQ_HZ, 3) != 0)
+  #define CLOCK_PLL_REFDIV           3UL
+#elif (CLOCK_PLL_SOLVE(CLOCK_SYS_FREQ_HZ, 4) != 0)
+  #define CLOCK_PLL_REFDIV           4UL
+#else
+  #error "CLOCK_SYS_FREQ_HZ cannot be generated exactly by PLL_SYS from CLOCK_XOSC_FREQ_HZ"
+#endif
+
+/* Dividers generating f with REFDIV r (r must have a solution) */
+#define CLOCK_PLL_POSTDIV1_OF(f, r)  ((uint32)(CLOCK_PLL_SOLVE(f, r) >> 4))
+#define CLOCK_PLL_POSTDIV2_OF(f, r)  ((uint32)(CLOCK_PLL_SOLVE(f, r) & 0x0FU))
+#define CLOCK_PLL_FBDIV_OF(f, r)     ((uint32)(((f) * 1ULL * CLOCK_PLL_POSTDIV1_OF(f, r) * CLOCK_PLL_POSTDIV2_OF(f, r)) / CLOCK_PLL_REF_HZ(r)))
+
+#define CLOCK_PLL_POSTDIV1           CLOCK_PLL_POSTDIV1_OF(CLOCK_SYS_FREQ_HZ, CLOCK_PLL_REFDIV)
+#define CLOCK_PLL_POSTDIV2           CLOCK_PLL_POSTDIV2_OF(CLOCK_SYS_FREQ_HZ, CLOCK_PLL_REFDIV)
+#define CLOCK_PLL_FBDIV              CLOCK_PLL_FBDIV_OF(CLOCK_SYS_FREQ_HZ, CLOCK_PLL_REFDIV)
+
+//=============================================================================
+// Dynamic frequency scaling
+//=============================================================================
+/* VREG output voltage (VREG.VSEL) */
+#define CLOCK_VREG_VSEL_0V95         8UL
+#define CLOCK_VREG_VSEL_1V00         9UL
+#define CLOCK_VREG_VSEL_1V05         10UL
+#define CLOCK_VREG_VSEL_1V10         11UL  /* reset value */
+#define CLOCK_VREG_VSEL_1V15         12UL
+#define CLOCK_VREG_VSEL_1V20         13UL
+#define CLOCK_VREG_VSEL_1V25         14UL
+#define CLOCK_VREG_VSEL_1V30         15UL
+
+/* Presets (the nominal preset is the boot clock CLOCK_SYS_FREQ_HZ) */
+#ifndef CLOCK_DFS_LOW_FREQ_HZ
+  #define CLOCK_DFS_LOW_FREQ_HZ      48000000UL
+#endif
+#ifndef CLOCK_DFS_LOW_VSEL
+  #define CLOCK_DFS_LOW_VSEL         CLOCK_VREG_VSEL_1V00
+#endif
+#ifndef CLOCK_DFS_NOMINAL_VSEL
+  #define CLOCK_DFS_NOMINAL_VSEL     CLOCK_VREG_VSEL_1V10
+#endif
+#ifndef CLOCK_DFS_BOOST_FREQ_HZ
+  #define CLOCK_DFS_BOOST_FREQ_HZ    250000000UL
+#endif
+#ifndef CLOCK_DFS_BOOST_VSEL
+  #define CLOCK_DFS_BOOST_VSEL       CLOCK_VREG_VSEL_1V20
+#endif
+
+#if (CLOCK_PLL_SOLVE(CLOCK_USB_FREQ_HZ, 1) == 0)
+  #error "CLOCK_USB_FREQ_HZ cannot be generated exactly by PLL_USB from CLOCK_XOSC_FREQ_HZ"
+#endif
+
+#if (CLOCK_PLL_SOLVE(CLOCK_DFS_LOW_FREQ_HZ, 1) == 0) || (CLOCK_PLL_SOLVE(CLOCK_DFS_BOOST_FREQ_HZ, 1) == 0)
+  #error "CLOCK_DFS_LOW_FREQ_HZ and CLOCK_DFS_BOOST_FREQ_HZ must be generated exactly by PLL_SYS with REFDIV = 1"
+#endif
+
+#define CLOCK_PRESET_LOW             0UL
+#define CLOCK_PRESET_NOMINAL         1UL
+#define CLOCK_PRESET_BOOST           2UL
+#define CLOCK_NB_OF_PRESETS          3UL
+
+/* Transition timing in TIMER ticks (us). A transition takes at most CLOCK_DFS_MAX_LATENCY_US
+   once the DFS lock is taken, a concurrent request from the other core waits for at most
+   one more transition. The clock-change notifiers run after the timed window, still under
+   the lock: their own cost adds to the lock hold time, not to the bound. */
+#ifndef CLOCK_VREG_SETTLE_US
+  #define CLOCK_VREG_SETTLE_US       1000UL
+#endif
+#ifndef CLOCK_PLL_LOCK_TIMEOUT_US
+  #define CLOCK_PLL_LOCK_TIMEOUT_US  1000UL
+#endif
+
+/* voltage rise + PLL lock (target, then the restore of the previous setting) + switches */
+#define CLOCK_DFS_MAX_LATENCY_US     (CLOCK_VREG_SETTLE_US + (2UL * CLOCK_PLL_LOCK_TIMEOUT_US) + 100UL)
+
+/* Hardware spinlock serializing the transitions of both cores */
+#define CLOCK_DFS_SPINLOCK           SPINLOCK_ID_CLOCK
+
+/* Clock-change notifiers (drivers whose timing derives from clk_sys) */
+#ifndef CLOCK_NB_OF_NOTIFIERS
+  #define CLOCK_NB_OF_NOTIFIERS      4UL
+#endif
+
+//=============================================================================
+// Clock gating
+//=============================================================================
+/* Blocks of a gating profile, identified by their RESETS bit: a block is considered in use
+   once its reset is released (RESET_DONE) */
+#define CLOCK_GATE_ADC               RESETS_RESET_DONE_adc_Msk
+#define CLOCK_GATE_DMA               RESETS_RESET_DONE_dma_Msk
+#define CLOCK_GATE_I2C0              RESETS_RESET_DONE_i2c0_Msk
+#define CLOCK_GATE_I2C1              RESETS_RESET_DONE_i2c1_Msk
+#define CLOCK_GATE_IO_BANK0          RESETS_RESET_DONE_io_bank0_Msk
+#define CLOCK_GATE_JTAG              RESETS_RESET_DONE_jtag_Msk
+#define CLOCK_GATE_PIO0              RESETS_RESET_DONE_pio0_Msk
+#define CLOCK_GATE_PIO1              RESETS_RESET_DONE_pio1_Msk
+#define CLOCK_GATE_PLL_USB           RESETS_RESET_DONE_pll_usb_Msk
+#define CLOCK_GATE_PWM               RESETS_RESET_DONE_pwm_Msk
+#define CLOCK_GATE_RTC               RESETS_RESET_DONE_rtc_Msk
+#define CLOCK_GATE_SPI0              RESETS_RESET_DONE_spi0_Msk
+#define CLOCK_GATE_SPI1              RESETS_RESET_DONE_spi1_Msk
+#define CLOCK_GATE_SYSINFO           RESETS_RESET_DONE_sysinfo_Msk
+#define CLOCK_GATE_TBMAN             RESETS_RESET_DONE_tbman_Msk
+#define CLOCK_GATE_TIMER             RESETS_RESET_DONE_timer_Msk
+#define CLOCK_GATE_UART0             RESETS_RESET_DONE_uart0_Msk
+#define CLOCK_GATE_UART1             RESETS_RESET_DONE_uart1_Msk
+#define CLOCK_GATE_USB               RESETS_RESET_DONE_usbctrl_Msk
+
+#define CLOCK_GATE_NB_OF_BLOCKS      19UL
+
+/* Clocks never gated while running: bus, memories, XIP (QSPI pins), clock/reset/power control,
+   oscillators, PLL_SYS, the watchdog (TIMER tick) and the TIMER (DFS and power timeouts) */
+#define CLOCK_GATE_BASE_EN0          (CLOCKS_WAKE_EN0_clk_sys_clocks_Msk    | CLOCKS_WAKE_EN0_clk_sys_busctrl_Msk   | \
+                                      CLOCKS_WAKE_EN0_clk_sys_busfabric_Msk | CLOCKS_WAKE_EN0_clk_sys_io_Msk        | \
+                                      CLOCKS_WAKE_EN0_clk_sys_pads_Msk      | CLOCKS_WAKE_EN0_clk_sys_vreg_and_chip_reset_Msk | \
+                                      CLOCKS_WAKE_EN0_clk_sys_pll_sys_Msk   | CLOCKS_WAKE_EN0_clk_sys_psm_Msk       | \
+                                      CLOCKS_WAKE_EN0_clk_sys_resets_Msk    | CLOCKS_WAKE_EN0_clk_sys_rom_Msk       | \
+                                      CLOCKS_WAKE_EN0_clk_sys_rosc_Msk      | CLOCKS_WAKE_EN0_clk_sys_sio_Msk       | \
+                                      CLOCKS_WAKE_EN0_clk_sys_sram0_Msk     | CLOCKS_WAKE_EN0_clk_sys_sram1_Msk     | \
+                                      CLOCKS_WAKE_EN0_clk_sys_sram2_Msk     | CLOCKS_WAKE_EN0_clk_sys_sram3_Msk)
+
+#define CLOCK_GATE_BASE_EN1          (CLOCKS_WAKE_EN1_clk_sys_sram4_Msk     | CLOCKS_WAKE_EN1_clk_sys_sram5_Msk     | \
+                                      CLOCKS_WAKE_EN1_clk_sys_syscfg_Msk    | CLOCKS_WAKE_EN1_clk_sys_watchdog_Msk  | \
+                                      CLOCKS_WAKE_EN1_clk_sys_xip_Msk       | CLOCKS_WAKE_EN1_clk_sys_xosc_Msk      | \
+                                      CLOCKS_WAKE_EN1_clk_sys_timer_Msk)
+
+//=============================================================================
+// Types definition
+//=============================================================================
+typedef struct
+{
+  uint32 u32Block;  /* CLOCK_GATE_xxx     */
+  uint32 u32En0;    /* WAKE_EN0/SLEEP_EN0 */
+  uint32 u32En1;    /* WAKE_EN1/SLEEP_EN1 */
+}Clock_GateMapType;
+
+typedef struct
+{
+  uint32 u32WakeEn0;
+  uint32 u32WakeEn1;
+  uint32 u32SleepEn0;
+  uint32 u32SleepEn1;
+}Clock_GateProfileType;
+
+/* Called with the new clk_sys frequency (Hz) */
+typedef void (*Clock_NotifierType)(uint32 u32SysFreqHz);
+
+typedef struct
+{
+  uint32 u32FreqHz;
+  uint32 u32RefDiv;
+  uint32 u32FbDiv;
+  uint32 u32PostDiv1;
+  uint32 u32PostDiv2;
+  uint32 u32VSel;
+}Clock_PresetType;
 
+/* Snapshot of the clock tree (oscillator, PLLs and clock generators) */
+typedef struct
+{
+  uint32 u32XoscCtrl;
+  uint32 u32RoscCtrl;
+  uint32 u32PllSys[4];   /* CS, PWR, FBDIV_INT, PRIM */
+  uint32 u32PllUsb[4];
+  uint32 u32RefCtrl;
+  uint32 u32RefDiv;
+  uint32 u32SysCtrl;
+  uint32 u32SysDiv;
+  uint32 u32PeriCtrl;
+  uint32 u32UsbCtrl;
+  uint32 u32UsbDiv;
+  uint32 u32AdcCtrl;
+  uint32 u32AdcDiv;
+  uint32 u32RtcCtrl;
+  uint32 u32RtcDiv;
+}Clock_ConfigType;
 
 //=============================================================================
 // Functions prototype
 //=============================================================================
 void RP2040_ClockInit(void);
+void RP2040_ClockStartXosc(void);
+void RP2040_ClockStartPlls(void);
+void RP2040_ClockFinishInit(void);
+void RP2040_ClockRoscBoost(void);
+boolean RP2040_ClockPollDeferred(void);
+void RP2040_ClockCompleteDeferred(void);
+boolean RP2040_ClockSetSysPreset(uint32 Preset);
+uint32 RP2040_ClockGetSysFreq(void);
+uint32 RP2040_ClockGetFreq(uint32 ClockId);
+uint32 RP2040_ClockGetDfsMaxLatency(void);
+uint32 RP2040_ClockGetDfsOverruns(void);
+void RP2040_ClockSaveConfig(Clock_ConfigType* pConfig);
+void RP2040_ClockRestoreConfig(const Clock_ConfigType* pConfig);
+boolean RP2040_ClockRegisterNotifier(Clock_NotifierType pNotifier);
+void RP2040_ClockGateBuildProfile(uint32 SleepBlocks, Clock_GateProfileType* pProfile);
+void RP2040_ClockGateApply(const Clock_GateProfileType* pProfile);
+boolean RP2040_ClockGateGetProfile(Clock_GateProfileType* pProfile);
 
 
 
@@ -0,0 +1,138 @@
+/******************************************************************************************
+  Filename    : ClockMeas.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Clock self-measurement with the frequency counter (FC0)
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "ClockMeas.h"
+#include "Clock.h"
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+static uint32 RP2040_ClockMeasRun(uint32 Source, uint32 RefKhz, uint32 ExpectedKhz, uint32 TolerancePercent, boolean* pboPass);
+
+//=============================================================================
+// Globals
+//=============================================================================
+volatile ClockMeas_EntryType ClockMeas_Table[CLOCKMEAS_NB_OF_CLOCKS];
+volatile uint32 ClockMeas_u32FailMask;
+
+/* FC0 source of each measured clock */
+static const uint8 ClockMeas_Source[CLOCKMEAS_NB_OF_CLOCKS] =
+{
+  CLOCKS_FC0_SRC_FC0_SRC_clk_sys,
+  CLOCKS_FC0_SRC_FC0_SRC_clk_ref,
+  CLOCKS_FC0_SRC_FC0_SRC_clk_peri,
+  CLOCKS_FC0_SRC_FC0_SRC_clk_usb,
+  CLOCKS_FC0_SRC_FC0_SRC_clk_adc,
+  CLOCKS_FC0_SRC_FC0_SRC_xosc_clksrc,
+  CLOCKS_FC0_SRC_FC0_SRC_rosc_clksrc
+};
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockMeasAll function
+///
+/// \param  void
+///
+/// \return mask of the clocks out of tolerance (bit CLOCKMEAS_xxx), 0 if all are fine
+///
+/// \note   FC0 counts against clk_ref: the clk_ref entry only checks the counter itself,
+///         the XOSC entry checks clk_ref against the crystal. Not reentrant (core 0 only).
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_ClockMeasAll(void)
+{
+  const uint32 RefKhz = RP2040_ClockGetFreq(CLOCK_ID_REF) / 1000UL;
+  uint32 FailMask = 0UL;
+  uint32 Clock;
+
+  for(Clock = 0UL; Clock < CLOCKMEAS_NB_OF_CLOCKS; Clock++)
+  {
+    uint32 ExpectedKhz;
+    uint32 TolerancePercent = CLOCKMEAS_TOLERANCE_PERCENT;
+    boolean boPass;
+
+    switch(Clock)
+    {
+      case CLOCKMEAS_CLK_SYS:  ExpectedKhz = RP2040_ClockGetFreq(CLOCK_ID_SYS)  / 1000UL; break;
+      case CLOCKMEAS_CLK_REF:  ExpectedKhz = RefKhz;                                     break;
+      case CLOCKMEAS_CLK_PERI: ExpectedKhz = RP2040_ClockGetFreq(CLOCK_ID_PERI) / 1000UL; break;
+      case CLOCKMEAS_CLK_USB:  ExpectedKhz = RP2040_ClockGetFreq(CLOCK_ID_USB)  / 1000UL; break;
+      case CLOCKMEAS_CLK_ADC:  ExpectedKhz = RP2040_ClockGetFreq(CLOCK_ID_ADC)  / 1000UL; break;
+      case CLOCKMEAS_XOSC:     ExpectedKhz = CLOCK_XOSC_FREQ_HZ / 1000UL;                break;
+      default:
+        ExpectedKhz      = CLOCK_ROSC_FREQ_HZ / 1000UL;
+        TolerancePercent = CLOCKMEAS_ROSC_TOLERANCE_PERCENT;
+        break;
+    }
+
+    ClockMeas_Table[Clock].u32ExpectedKhz = ExpectedKhz;
+    ClockMeas_Table[Clock].u32MeasuredKhz = RP2040_ClockMeasRun(ClockMeas_Source[Clock], RefKhz, ExpectedKhz, TolerancePercent, &boPass);
+
+    if(boPass == FALSE)
+    {
+      FailMask |= (1UL << Clock);
+    }
+  }
+
+  ClockMeas_u32FailMask = FailMask;
+
+  return(FailMask);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockMeasGetHz function
+///
+/// \param  Clock : CLOCKMEAS_xxx
+///
+/// \return last measured frequency in Hz (1 kHz resolution), 0 if not measured
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_ClockMeasGetHz(uint32 Clock)
+{
+  return((Clock < CLOCKMEAS_NB_OF_CLOCKS) ? (ClockMeas_Table[Clock].u32MeasuredKhz * 1000UL) : 0UL);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ClockMeasRun function
+///
+/// \param  Source           : FC0 source (CLOCKS_FC0_SRC_FC0_SRC_xxx)
+///         RefKhz           : clk_ref frequency in kHz
+///         ExpectedKhz      : expected frequency in kHz (0: the clock must be stopped)
+///         TolerancePercent : accepted deviation
+///         pboPass          : TRUE if the result lies in the accepted window
+///
+/// \return measured frequency in kHz
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_ClockMeasRun(uint32 Source, uint32 RefKhz, uint32 ExpectedKhz, uint32 TolerancePercent, boolean* pboPass)
+{
+  const uint32 Margin = (ExpectedKhz * TolerancePercent) / 100UL;
+
+  /* The window is checked by the counter itself (PASS status) */
+  while((CLOCKS->FC0_STATUS.reg & CLOCKS_FC0_STATUS_RUNNING_Msk) != 0UL);
+
+  CLOCKS->FC0_REF_KHZ.reg  = RefKhz;
+  CLOCKS->FC0_INTERVAL.reg = CLOCKMEAS_FC0_INTERVAL;
+  CLOCKS->FC0_MIN_KHZ.reg  = ExpectedKhz - Margin;
+  CLOCKS->FC0_MAX_KHZ.reg  = ExpectedKhz + Margin + ((ExpectedKhz == 0UL) ? 1UL : 0UL);
+  CLOCKS->FC0_SRC.reg      = Source;
+
+  while((CLOCKS->FC0_STATUS.reg & CLOCKS_FC0_STATUS_DONE_Msk) == 0UL);
+
+  *pboPass = ((CLOCKS->FC0_STATUS.reg & CLOCKS_FC0_STATUS_PASS_Msk) != 0UL) ? TRUE : FALSE;
+
+  return((CLOCKS->FC0_RESULT.reg & CLOCKS_FC0_RESULT_KHZ_Msk) >> CLOCKS_FC0_RESULT_KHZ_Pos);
+}
@@ -0,0 +1,76 @@
+/******************************************************************************************
+  Filename    : ClockMeas.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Clock self-measurement with the frequency counter (FC0) header file
+  
+******************************************************************************************/
+#ifndef __RP2040_CLOCK_MEAS_H__
+#define __RP2040_CLOCK_MEAS_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* Measured clocks (index in ClockMeas_Table, bit in the fail mask) */
+#define CLOCKMEAS_CLK_SYS               0UL
+#define CLOCKMEAS_CLK_REF               1UL
+#define CLOCKMEAS_CLK_PERI              2UL
+#define CLOCKMEAS_CLK_USB               3UL
+#define CLOCKMEAS_CLK_ADC               4UL
+#define CLOCKMEAS_XOSC                  5UL
+#define CLOCKMEAS_ROSC                  6UL
+#define CLOCKMEAS_NB_OF_CLOCKS          7UL
+
+/* Accepted deviation from the expected frequency */
+#ifndef CLOCKMEAS_TOLERANCE_PERCENT
+  #define CLOCKMEAS_TOLERANCE_PERCENT   2UL
+#endif
+
+/* The ROSC frequency varies with process, voltage and temperature */
+#ifndef CLOCKMEAS_ROSC_TOLERANCE_PERCENT
+  #define CLOCKMEAS_ROSC_TOLERANCE_PERCENT  75UL
+#endif
+
+/* Counting interval: 2^FC0_INTERVAL us (10: ~1 ms, 1 kHz resolution) */
+#define CLOCKMEAS_FC0_INTERVAL          10UL
+
+//=============================================================================
+// Types definition
+//=============================================================================
+typedef struct
+{
+  uint32 u32MeasuredKhz;
+  uint32 u32ExpectedKhz;
+}ClockMeas_EntryType;
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* Results of the last RP2040_ClockMeasAll() */
+extern volatile ClockMeas_EntryType ClockMeas_Table[CLOCKMEAS_NB_OF_CLOCKS];
+extern volatile uint32 ClockMeas_u32FailMask;
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+uint32 RP2040_ClockMeasAll(void);
+uint32 RP2040_ClockMeasGetHz(uint32 Clock);
+
+#endif /*__RP2040_CLOCK_MEAS_H__*/
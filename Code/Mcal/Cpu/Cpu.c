@@ -19,11 +19,25 @@
 // Includes
 //=============================================================================
 #include "Cpu.h"
+#include "Timer.h"
 
 //=============================================================================
 // Globals
 //=============================================================================
-static volatile uint32 u32MulticoreSync = 0;
+static Cpu_BarrierType Cpu_MulticoreBarrier;
+
+/* Read by core 1 after the handshake, core 1 is held in the BootRom while they are written */
+static volatile Cpu_Core1EntryType Cpu_Core1Entry;
+static volatile uint32 Cpu_Core1Arg;
+static Cpu_Core1StatsType Cpu_Core1Stats;
+
+//=============================================================================
+// Static functions prototype
+//=============================================================================
+static boolean RP2040_Core1Launch(uint32 VectorTable, uint32 StackPointer, uint32 EntryPoint, uint32* pRetries);
+static void RP2040_Core1Record(boolean boLaunched, uint32 Retries, uint64 Start);
+static boolean RP2040_Core1Handshake(const uint32* pLaunchSequence);
+static void RP2040_Core1Trampoline(void);
 
 
 //-----------------------------------------------------------------------------------------
@@ -32,35 +46,110 @@ static volatile uint32 u32MulticoreSync = 0;
 /// \param  CpuId : The cpu core identifier
 ///
 /// \return void
+///
+/// \note   Reusable: both cores may synchronize any number of times (e.g. every frame).
 //-----------------------------------------------------------------------------------------
 void RP2040_MulticoreSync(uint32 CpuId)
 {
-  u32MulticoreSync |= (1UL << CpuId);
+  RP2040_BarrierWait(&Cpu_MulticoreBarrier, CpuId);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_BarrierInit function
+///
+/// \param  pBarrier : barrier to reset (no core may be waiting on it)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_BarrierInit(Cpu_BarrierType* pBarrier)
+{
+  pBarrier->u32Count = 0UL;
+  pBarrier->u32Sense = 0UL;
 
-  while(u32MulticoreSync != MULTICORE_SYNC_MASK);
+  for(uint32 idx = 0UL; idx < CPU_NB_OF_CORES; idx++)
+  {
+    pBarrier->u32LocalSense[idx] = 0UL;
+  }
+
+  __asm volatile("DMB" ::: "memory");
 }
 
 //-----------------------------------------------------------------------------------------
-/// \brief  RP2040_StartCore1 function
+/// \brief  RP2040_BarrierWait function
 ///
-/// \param  void
+/// \param  pBarrier : barrier shared by both cores
+///         CpuId    : The cpu core identifier
 ///
 /// \return void
+///
+/// \note   The arrival counter is updated under a hardware spinlock (interrupts masked),
+///         the last core to arrive flips the shared sense and wakes the other one (SEV).
 //-----------------------------------------------------------------------------------------
-void RP2040_InitCore(void)
+void RP2040_BarrierWait(Cpu_BarrierType* pBarrier, uint32 CpuId)
 {
-  /* we came here from the RP2040 BootRom and SBL */
-  /* Reset core1 to start from a known state */
+  const uint32 Sense = pBarrier->u32LocalSense[CpuId] ^ 1UL;
+  boolean boLast = FALSE;
+  uint32 Token;
 
-  PSM->FRCE_OFF.bit.proc1 = 1U;
+  pBarrier->u32LocalSense[CpuId] = Sense;
 
-  while((PSM->DONE.bit.proc1 == 1U));
+  Token = RP2040_SpinlockAcquire(CPU_BARRIER_SPINLOCK, TRUE);
 
-  PSM->FRCE_OFF.bit.proc1 = 0U;
+  pBarrier->u32Count++;
 
-  while((PSM->DONE.bit.proc1 != 1U));
+  if(pBarrier->u32Count == CPU_NB_OF_CORES)
+  {
+    /* Last arrival: open the barrier for this round, ready for the next one */
+    pBarrier->u32Count = 0UL;
+    pBarrier->u32Sense = Sense;
+    boLast = TRUE;
+  }
+
+  RP2040_SpinlockRelease(CPU_BARRIER_SPINLOCK, Token);
+
+  if(boLast == TRUE)
+  {
+    __asm volatile("DSB" ::: "memory");
+    __asm volatile("SEV");
+  }
+  else
+  {
+    /* The event latched by a SEV issued before this WFE is not lost */
+    while(pBarrier->u32Sense != Sense)
+    {
+      __asm volatile("WFE");
+    }
+  }
+
+  __asm volatile("DMB" ::: "memory");
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_InitCore function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_InitCore(void)
+{
+  /* we came here from the RP2040 BootRom and SBL */
+  /* Reset core1 to start from a known state */
+  RP2040_ResetCore1();
 
   /* Reset peripheral to start from a known state */
+  RP2040_InitIoBanks();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_InitIoBanks function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_InitIoBanks(void)
+{
   RESETS->RESET.bit.io_bank0   = 1U;
   RESETS->RESET.bit.pads_bank0 = 1U;
 
@@ -70,7 +159,25 @@ void RP2040_InitCore(void)
   RESETS->RESET.bit.pads_bank0 = 0U;
 
   while((RESETS->RESET_DONE.bit.io_bank0 == 0U) || (RESETS->RESET_DONE.bit.pads_bank0 == 0U));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_ResetCore1 function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_ResetCore1(void)
+{
+  /* Power cycle core 1, it restarts in the BootRom waiting for the launch sequence */
+  PSM->FRCE_OFF.bit.proc1 = 1U;
 
+  while((PSM->DONE.bit.proc1 == 1U));
+
+  PSM->FRCE_OFF.bit.proc1 = 0U;
+
+  while((PSM->DONE.bit.proc1 != 1U));
 }
 
 //-----------------------------------------------------------------------------------------
@@ -78,75 +185,322 @@ void RP2040_InitCore(void)
 ///
 /// \param  void
 ///
-/// \return void
+/// \return TRUE if core 1 acknowledged the launch sequence, FALSE otherwise
+///
+/// \note   Called after the RAM initialization, the launch is recorded in the statistics.
 //-----------------------------------------------------------------------------------------
 boolean RP2040_StartCore1(void)
 {
   extern uint32 __INTVECT_Core1[2];
 
-  /* Flush the mailbox */
-  while(SIO->FIFO_ST.bit.VLD == 1UL)
+  uint32 Retries;
+  uint64 Start;
+  boolean boLaunched;
+
+  if(RESETS->RESET_DONE.bit.timer == 0U)
   {
-    (void)SIO->FIFO_RD;
+    RP2040_TimerInit();
   }
 
-  /* Send 0 to wakeup the core 1 */
-  SIO->FIFO_WR = 0;
-  __asm("SEV");
+  Start      = RP2040_TimerGetTime();
+  boLaunched = RP2040_Core1Launch((uint32)(&__INTVECT_Core1[0]), (uint32)__INTVECT_Core1[0], (uint32)__INTVECT_Core1[1], &Retries);
+
+  RP2040_Core1Record(boLaunched, Retries, Start);
+
+  return(boLaunched);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_StartCore1Entry function
+///
+/// \param  Entry : function executed by core 1 (with the core 1 vector table and stack)
+///
+/// \return TRUE if core 1 acknowledged the launch sequence, FALSE otherwise
+//-----------------------------------------------------------------------------------------
+boolean RP2040_StartCore1Entry(pFunc Entry)
+{
+  extern uint32 __INTVECT_Core1[2];
+
+  return(RP2040_LaunchCore1((uint32)(&__INTVECT_Core1[0]), (uint32)__INTVECT_Core1[0], (uint32)Entry));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_LaunchCore1 function
+///
+/// \param  VectorTable  : VTOR value of core 1
+///         StackPointer : initial stack pointer of core 1
+///         EntryPoint   : address of the function executed by core 1
+///
+/// \return TRUE if core 1 acknowledged the launch sequence, FALSE otherwise
+///
+/// \note   Called from core 0. A handshake that times out or gets a wrong answer is retried
+///         up to CPU_CORE1_LAUNCH_RETRIES times, with core 1 power cycled in between.
+///         Usable before the RAM initialization: nothing is written to .data/.bss.
+//-----------------------------------------------------------------------------------------
+boolean RP2040_LaunchCore1(uint32 VectorTable, uint32 StackPointer, uint32 EntryPoint)
+{
+  uint32 Retries;
+
+  return(RP2040_Core1Launch(VectorTable, StackPointer, EntryPoint, &Retries));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_Core1Launch static function
+///
+/// \param  VectorTable  : VTOR value of core 1
+///         StackPointer : initial stack pointer of core 1
+///         EntryPoint   : address of the function executed by core 1
+///         pRetries     : number of handshakes restarted
+///
+/// \return TRUE if core 1 acknowledged the launch sequence, FALSE otherwise
+//-----------------------------------------------------------------------------------------
+static boolean RP2040_Core1Launch(uint32 VectorTable, uint32 StackPointer, uint32 EntryPoint, uint32* pRetries)
+{
+  /* BootRom launch protocol: 0 to wakeup, 1 to synchronize, then VTOR, SP and entry */
+  const uint32 LaunchSequence[CPU_CORE1_LAUNCH_SEQ_LENGTH] = {0UL, 1UL, VectorTable, StackPointer, EntryPoint};
 
-  while(SIO->FIFO_ST.bit.VLD != 1UL);
+  /* The mailbox interrupt would consume the answers of the BootRom */
+  const uint32 IrqMask    = 1UL << (uint32)SIO_IRQ_PROC0_IRQn;
+  const uint32 IrqEnabled = NVIC->ISER[0] & IrqMask;
+  boolean boResult        = FALSE;
 
-  if(SIO->FIFO_RD != 0U)
+  *pRetries     = 0UL;
+  NVIC->ICER[0] = IrqMask;
+
+  /* The handshake timeouts are measured with the TIMER */
+  if(RESETS->RESET_DONE.bit.timer == 0U)
   {
-    return(FALSE);
+    RP2040_TimerInit();
   }
 
-  /* Send 1 to synchronize with Core 1*/
-  SIO->FIFO_WR = 1;
-  __asm("SEV");
+  for(uint32 Attempt = 0UL; Attempt <= CPU_CORE1_LAUNCH_RETRIES; Attempt++)
+  {
+    if(Attempt != 0UL)
+    {
+      /* Back to the start of the BootRom wait loop */
+      RP2040_ResetCore1();
+      (*pRetries)++;
+    }
+
+    if(RP2040_Core1Handshake(&LaunchSequence[0]) == TRUE)
+    {
+      boResult = TRUE;
+      break;
+    }
+  }
+
+  /* Clear the stiky bits of the FIFO_ST on core 0 */
+  SIO->FIFO_ST.reg = 0xFFu;
+
+  NVIC->ICPR[0] = IrqMask;
+  NVIC->ISER[0] = IrqEnabled;
+
+  return(boResult);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RelaunchCore1 function
+///
+/// \param  pEntry    : function executed by core 1, called with Arg
+///         Arg       : argument of pEntry
+///         pStack    : stack of core 1 (NULL_PTR: the linker-defined core 1 stack)
+///         StackSize : size of pStack in bytes (at least CPU_CORE1_STACK_MIN_SIZE)
+///
+/// \return TRUE if core 1 runs pEntry, FALSE if it stays in reset
+///
+/// \note   Called from core 0 at runtime (after the RAM initialization). Core 1 is power
+///         cycled whatever it was doing, the spinlocks it held are released (a barrier it
+///         was waiting on must be re-initialized). It keeps the core 1 vector table:
+///         interrupts enabled by pEntry use the core 1 handlers.
+//-----------------------------------------------------------------------------------------
+boolean RP2040_RelaunchCore1(Cpu_Core1EntryType pEntry, uint32 Arg, uint32* pStack, uint32 StackSize)
+{
+  extern uint32 __INTVECT_Core1[2];
 
-  while(SIO->FIFO_ST.bit.VLD != 1UL);
+  uint32 StackPointer = (uint32)__INTVECT_Core1[0];
+  uint64 Start;
+  uint32 Retries;
+  boolean boLaunched;
 
-  if(SIO->FIFO_RD != 1U)
+  if((pEntry == NULL_PTR) || ((pStack != NULL_PTR) && (StackSize < CPU_CORE1_STACK_MIN_SIZE)))
   {
     return(FALSE);
   }
 
-  /* Send the VTOR address */
-  SIO->FIFO_WR = (uint32)(&__INTVECT_Core1[0]);
-  __asm("SEV");
+  if(pStack != NULL_PTR)
+  {
+    /* Full descending stack, 8-byte aligned as required by the AAPCS */
+    StackPointer = ((uint32)pStack + StackSize) & ~7UL;
+  }
+
+  if(RESETS->RESET_DONE.bit.timer == 0U)
+  {
+    RP2040_TimerInit();
+  }
+
+  Start = RP2040_TimerGetTime();
 
-  while(SIO->FIFO_ST.bit.VLD != 1UL);
+  RP2040_ResetCore1();
+  RP2040_SpinlockReleaseCore(CPU_CORE1_ID);
 
-  if(SIO->FIFO_RD != (uint32)(&__INTVECT_Core1[0]))
+  Cpu_Core1Entry = pEntry;
+  Cpu_Core1Arg   = Arg;
+  __asm volatile("DMB" ::: "memory");
+
+  boLaunched = RP2040_Core1Launch((uint32)(&__INTVECT_Core1[0]), StackPointer, (uint32)&RP2040_Core1Trampoline, &Retries);
+
+  if(boLaunched == FALSE)
   {
-    return(FALSE);
+    /* Do not leave core 1 half-way through the BootRom protocol */
+    RP2040_ResetCore1();
   }
 
-  /* Send the stack pointer value */
-  SIO->FIFO_WR = (uint32)__INTVECT_Core1[0];
-  __asm("SEV");
+  RP2040_Core1Record(boLaunched, Retries, Start);
+
+  return(boLaunched);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_Core1Record static function
+///
+/// \param  boLaunched : result of the launch
+///         Retries    : number of handshakes restarted
+///         Start      : timer value taken before the launch
+///
+/// \return void
+///
+/// \note   Only called after the RAM initialization: Cpu_Core1Stats lives in .bss.
+//-----------------------------------------------------------------------------------------
+static void RP2040_Core1Record(boolean boLaunched, uint32 Retries, uint64 Start)
+{
+  const uint32 Latency = (uint32)(RP2040_TimerGetTime() - Start);
 
-  while(SIO->FIFO_ST.bit.VLD != 1UL);
+  Cpu_Core1Stats.u32Retries += Retries;
 
-  if(SIO->FIFO_RD != (uint32)__INTVECT_Core1[0])
+  if(boLaunched == FALSE)
   {
-    return(FALSE);
+    Cpu_Core1Stats.u32Failures++;
+    return;
   }
 
-  /* Send the reset handler */
-  SIO->FIFO_WR = (uint32)__INTVECT_Core1[1];
-  __asm("SEV");
+  Cpu_Core1Stats.u32Launches++;
+  Cpu_Core1Stats.u32LastLatencyUs = Latency;
+
+  if(Latency > Cpu_Core1Stats.u32MaxLatencyUs)
+  {
+    Cpu_Core1Stats.u32MaxLatencyUs = Latency;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_Core1GetStats function
+///
+/// \param  pStats : copy of the core 1 launch statistics
+///
+/// \return void
+///
+/// \note   Only RP2040_StartCore1 and RP2040_RelaunchCore1 are recorded. The startup launch
+///         (STARTUP_RAM_INIT_DUAL_CORE) runs before .bss is cleared and is not counted.
+//-----------------------------------------------------------------------------------------
+void RP2040_Core1GetStats(Cpu_Core1StatsType* pStats)
+{
+  if(pStats != NULL_PTR)
+  {
+    *pStats = Cpu_Core1Stats;
+  }
+}
 
-  while(SIO->FIFO_ST.bit.VLD != 1UL);
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_Core1Handshake static function
+///
+/// \param  pLaunchSequence : the CPU_CORE1_LAUNCH_SEQ_LENGTH words of the launch protocol
+///
+/// \return TRUE if core 1 echoed every word, FALSE on a wrong answer or a timeout
+//-----------------------------------------------------------------------------------------
+static boolean RP2040_Core1Handshake(const uint32* pLaunchSequence)
+{
+  uint64 Start;
 
-  if(SIO->FIFO_RD != (uint32)__INTVECT_Core1[1])
+  /* Flush the mailbox */
+  while(SIO->FIFO_ST.bit.VLD == 1UL)
   {
-    return(FALSE);
+    (void)SIO->FIFO_RD;
   }
 
-  /* Clear the stiky bits of the FIFO_ST on core 0 */
-  SIO->FIFO_ST.reg = 0xFFu;
+  for(uint32 idx = 0UL; idx < CPU_CORE1_LAUNCH_SEQ_LENGTH; idx++)
+  {
+    SIO->FIFO_WR = pLaunchSequence[idx];
+    __asm("SEV");
+
+    /* The BootRom answers with a FIFO write followed by SEV,
+       polled rather than WFE so that a dead core 1 cannot block us */
+    Start = RP2040_TimerGetTime();
+
+    while(SIO->FIFO_ST.bit.VLD != 1UL)
+    {
+      if((RP2040_TimerGetTime() - Start) > CPU_CORE1_LAUNCH_TIMEOUT_US)
+      {
+        return(FALSE);
+      }
+    }
+
+    if(SIO->FIFO_RD != pLaunchSequence[idx])
+    {
+      return(FALSE);
+    }
+  }
 
   return(TRUE);
 }
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_Core1Trampoline static function (executed by core 1)
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_Core1Trampoline(void)
+{
+  __asm volatile("DMB" ::: "memory");
+
+  Cpu_Core1Entry(Cpu_Core1Arg);
+
+  /* Workload done: park core 1 until the next relaunch */
+  for(;;)
+  {
+    __asm volatile("WFI");
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_FifoPush function
+///
+/// \param  Data : word sent to the other core
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_FifoPush(uint32 Data)
+{
+  while(SIO->FIFO_ST.bit.RDY != 1UL);
+
+  SIO->FIFO_WR = Data;
+  __asm("SEV");
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_FifoPop function
+///
+/// \param  void
+///
+/// \return word received from the other core
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_FifoPop(void)
+{
+  while(SIO->FIFO_ST.bit.VLD != 1UL)
+  {
+    __asm("WFE");
+  }
+
+  return(SIO->FIFO_RD);
+}
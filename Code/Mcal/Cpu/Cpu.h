@@ -22,6 +22,7 @@
 //=============================================================================
 #include "RP2040.h"
 #include "Platform_Types.h"
+#include "Spinlock.h"
 
 //=============================================================================
 // Defines
@@ -29,13 +30,64 @@
 #define CPU_CORE0_ID   0UL
 #define CPU_CORE1_ID   1UL
 
-#define MULTICORE_SYNC_MASK  (uint32)((1UL << CPU_CORE0_ID) | (1UL << CPU_CORE1_ID))
+#define CPU_NB_OF_CORES  2UL
+
+/* Hardware spinlock protecting the arrival counters of the barriers */
+#define CPU_BARRIER_SPINLOCK  SPINLOCK_ID_BARRIER
+
+#define CPU_CORE1_LAUNCH_SEQ_LENGTH  5UL
+
+/* Timeout of each step of the launch handshake, the BootRom answers within a few us */
+#ifndef CPU_CORE1_LAUNCH_TIMEOUT_US
+  #define CPU_CORE1_LAUNCH_TIMEOUT_US  1000UL
+#endif
+
+/* Launch attempts after the first one, core 1 is power cycled before each retry */
+#ifndef CPU_CORE1_LAUNCH_RETRIES
+  #define CPU_CORE1_LAUNCH_RETRIES     3UL
+#endif
+
+/* Smallest caller-provided stack accepted by RP2040_RelaunchCore1 (bytes) */
+#define CPU_CORE1_STACK_MIN_SIZE       256UL
+
+//=============================================================================
+// Types definition
+//=============================================================================
+/* Sense-reversing barrier, reusable (zero-initialized or RP2040_BarrierInit) */
+typedef struct
+{
+  volatile uint32 u32Count;                      /* cores arrived in the current round */
+  volatile uint32 u32Sense;                      /* flipped by the last core of a round */
+  volatile uint32 u32LocalSense[CPU_NB_OF_CORES];
+}Cpu_BarrierType;
+
+/* Function run by core 1 after a relaunch, it parks core 1 when it returns */
+typedef void (*Cpu_Core1EntryType)(uint32 u32Arg);
+
+typedef struct
+{
+  uint32 u32Launches;        /* successful StartCore1/RelaunchCore1 calls */
+  uint32 u32Retries;         /* handshakes restarted (timeout, bad echo)  */
+  uint32 u32Failures;        /* launches given up after all the retries   */
+  uint32 u32LastLatencyUs;   /* reset to handshake done of the last one  */
+  uint32 u32MaxLatencyUs;
+}Cpu_Core1StatsType;
 
 //=============================================================================
 // Functions prototype
 //=============================================================================
 void RP2040_MulticoreSync(uint32 CpuId);
+void RP2040_BarrierInit(Cpu_BarrierType* pBarrier);
+void RP2040_BarrierWait(Cpu_BarrierType* pBarrier, uint32 CpuId);
 boolean RP2040_StartCore1(void);
+boolean RP2040_StartCore1Entry(pFunc Entry);
+boolean RP2040_LaunchCore1(uint32 VectorTable, uint32 StackPointer, uint32 EntryPoint);
+boolean RP2040_RelaunchCore1(Cpu_Core1EntryType pEntry, uint32 Arg, uint32* pStack, uint32 StackSize);
+void RP2040_Core1GetStats(Cpu_Core1StatsType* pStats);
 void RP2040_InitCore(void);
+void RP2040_ResetCore1(void);
+void RP2040_InitIoBanks(void);
+void RP2040_FifoPush(uint32 Data);
+uint32 RP2040_FifoPop(void);
 
 #endif /*__RP2040_CPU_H__*/
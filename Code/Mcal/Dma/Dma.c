@@ -0,0 +1,138 @@
+/******************************************************************************************
+  Filename    : Dma.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : DMA memory transfers for RP2040 (used by the startup RAM initialization)
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Dma.h"
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+static uint32 RP2040_DmaStart(uint32 targetAddr, uint32 sourceAddr, uint32 words, uint32 IncrRead);
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* Fixed read address used to zero-fill memory (must live in flash: RAM is not yet initialized) */
+static const uint32 u32DmaZeroWord = 0UL;
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_DmaInit function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_DmaInit(void)
+{
+  /* Reset the DMA to start with all channels disabled */
+  RESETS->RESET.bit.dma = 1U;
+  while(RESETS->RESET_DONE.bit.dma == 1U);
+
+  RESETS->RESET.bit.dma = 0U;
+  while(RESETS->RESET_DONE.bit.dma != 1U);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_DmaMemCopy function
+///
+/// \param  targetAddr : word-aligned destination address
+///         sourceAddr : word-aligned source address
+///         words      : number of words to copy
+///
+/// \return number of words handed to the DMA (0 if no channel is free)
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_DmaMemCopy(uint32 targetAddr, uint32 sourceAddr, uint32 words)
+{
+  return(RP2040_DmaStart(targetAddr, sourceAddr, words, 1UL));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_DmaMemClear function
+///
+/// \param  targetAddr : word-aligned destination address
+///         words      : number of words to clear
+///
+/// \return number of words handed to the DMA (0 if no channel is free)
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_DmaMemClear(uint32 targetAddr, uint32 words)
+{
+  return(RP2040_DmaStart(targetAddr, (uint32)&u32DmaZeroWord, words, 0UL));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_DmaWaitMemTransfers function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_DmaWaitMemTransfers(void)
+{
+  for(uint32 ch = 0UL; ch < DMA_NB_OF_CHANNELS; ch++)
+  {
+    /* Wait for the end of the transfer */
+    while((DMA_CHANNEL(ch)->CTRL_TRIG & DMA_CH0_CTRL_TRIG_BUSY_Msk) != 0UL);
+
+    /* Release the channel */
+    DMA_CHANNEL(ch)->CTRL_TRIG = 0UL;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_DmaStart function
+///
+/// \param  targetAddr : word-aligned destination address
+///         sourceAddr : word-aligned source address
+///         words      : number of words to transfer
+///         IncrRead   : 0 to keep reading the same source word
+///
+/// \return number of words handed to the DMA (0 if no channel is free)
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_DmaStart(uint32 targetAddr, uint32 sourceAddr, uint32 words, uint32 IncrRead)
+{
+  if(words == 0UL)
+  {
+    return(0UL);
+  }
+
+  /* A channel is free as long as it has never been enabled since RP2040_DmaInit */
+  for(uint32 ch = 0UL; ch < DMA_NB_OF_CHANNELS; ch++)
+  {
+    if((DMA_CHANNEL(ch)->CTRL_TRIG & DMA_CH0_CTRL_TRIG_EN_Msk) == 0UL)
+    {
+      DMA_CHANNEL(ch)->READ_ADDR   = sourceAddr;
+      DMA_CHANNEL(ch)->WRITE_ADDR  = targetAddr;
+      DMA_CHANNEL(ch)->TRANS_COUNT = words;
+
+      /* Unpaced word transfers, no chaining (CHAIN_TO = own channel), no IRQ */
+      DMA_CHANNEL(ch)->CTRL_TRIG = (1UL                         << DMA_CH0_CTRL_TRIG_EN_Pos)
+                                 | (DMA_CTRL_DATA_SIZE_WORD     << DMA_CH0_CTRL_TRIG_DATA_SIZE_Pos)
+                                 | (IncrRead                    << DMA_CH0_CTRL_TRIG_INCR_READ_Pos)
+                                 | (1UL                         << DMA_CH0_CTRL_TRIG_INCR_WRITE_Pos)
+                                 | (ch                          << DMA_CH0_CTRL_TRIG_CHAIN_TO_Pos)
+                                 | (DMA_CTRL_TREQ_SEL_PERMANENT << DMA_CH0_CTRL_TRIG_TREQ_SEL_Pos)
+                                 | (1UL                         << DMA_CH0_CTRL_TRIG_IRQ_QUIET_Pos);
+
+      return(words);
+    }
+  }
+
+  return(0UL);
+}
@@ -0,0 +1,55 @@
+/******************************************************************************************
+  Filename    : Dma.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : DMA memory transfer header file for RP2040
+  
+******************************************************************************************/
+#ifndef __RP2040_DMA_H__
+#define __RP2040_DMA_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Types definition
+//=============================================================================
+typedef struct
+{
+  volatile uint32 READ_ADDR;
+  volatile uint32 WRITE_ADDR;
+  volatile uint32 TRANS_COUNT;
+  volatile uint32 CTRL_TRIG;
+  volatile uint32 ALIAS[12];
+}Dma_ChannelType;
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define DMA_NB_OF_CHANNELS             12UL
+#define DMA_CHANNEL(ch)                ((volatile Dma_ChannelType*)(DMA_BASE + (0x40UL * (uint32)(ch))))
+
+#define DMA_CTRL_DATA_SIZE_WORD        2UL
+#define DMA_CTRL_TREQ_SEL_PERMANENT    0x3FUL
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+void RP2040_DmaInit(void);
+uint32 RP2040_DmaMemCopy(uint32 targetAddr, uint32 sourceAddr, uint32 words);
+uint32 RP2040_DmaMemClear(uint32 targetAddr, uint32 words);
+void RP2040_DmaWaitMemTransfers(void);
+
+#endif /*__RP2040_DMA_H__*/
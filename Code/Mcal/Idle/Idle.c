@@ -0,0 +1,120 @@
+/******************************************************************************************
+  Filename    : Idle.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Event-driven core idle (WFE) for RP2040
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Idle.h"
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* Idle hook of each core, called before the core is parked */
+static volatile pFunc Idle_Hooks[IDLE_NB_OF_CORES];
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_IdleInit function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   To be called on each core. With SEVONPEND, a pending interrupt wakes the core from
+///         WFE even when it is masked, so the FIFO IRQ (SIO_IRQ_PROCn) of a core wakes it up
+///         whenever the other core writes to the mailbox, without any handler.
+//-----------------------------------------------------------------------------------------
+void RP2040_IdleInit(void)
+{
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+  /* Start with a clean pending state of the FIFO IRQ of this core */
+  NVIC->ICPR[0] = (1UL << ((uint32)SIO_IRQ_PROC0_IRQn + SIO->CPUID));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_IdleSetHook function
+///
+/// \param  CpuId : core running the hook (CPU_COREx_ID)
+///         Hook  : function called each time the core goes idle (NULL_PTR: none)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_IdleSetHook(uint32 CpuId, pFunc Hook)
+{
+  if(CpuId < IDLE_NB_OF_CORES)
+  {
+    Idle_Hooks[CpuId] = Hook;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_IdleWait function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   Parks the calling core until the next event: SEV from the other core, mailbox
+///         data (FIFO IRQ pending) or any interrupt. Spurious wakeups are possible, callers
+///         re-check their condition in a loop.
+//-----------------------------------------------------------------------------------------
+void RP2040_IdleWait(void)
+{
+  const uint32 CpuId = SIO->CPUID;
+  const pFunc Hook   = Idle_Hooks[CpuId];
+
+  if(Hook != NULL_PTR)
+  {
+    Hook();
+  }
+
+  __asm volatile("WFE" ::: "memory");
+
+  /* Re-arm the wakeup on the next mailbox write (the IRQ stays pending while data is present) */
+  NVIC->ICPR[0] = (1UL << ((uint32)SIO_IRQ_PROC0_IRQn + CpuId));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_IdleLoop function
+///
+/// \param  void
+///
+/// \return never returns
+//-----------------------------------------------------------------------------------------
+void RP2040_IdleLoop(void)
+{
+  for(;;)
+  {
+    RP2040_IdleWait();
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_IdleWakeOther function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   Wakes the other core from RP2040_IdleWait (SEV is seen by both cores).
+//-----------------------------------------------------------------------------------------
+void RP2040_IdleWakeOther(void)
+{
+  __asm volatile("DSB" ::: "memory");
+  __asm volatile("SEV");
+}
@@ -0,0 +1,40 @@
+/******************************************************************************************
+  Filename    : Idle.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Event-driven core idle (WFE) header file for RP2040
+  
+******************************************************************************************/
+#ifndef __RP2040_IDLE_H__
+#define __RP2040_IDLE_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define IDLE_NB_OF_CORES   2UL
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+void RP2040_IdleInit(void);
+void RP2040_IdleSetHook(uint32 CpuId, pFunc Hook);
+void RP2040_IdleWait(void);
+void RP2040_IdleLoop(void) __attribute__((noreturn));
+void RP2040_IdleWakeOther(void);
+
+#endif /*__RP2040_IDLE_H__*/
@@ -0,0 +1,223 @@
+/******************************************************************************************
+  Filename    : Mailbox.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Inter-core mailbox over the SIO FIFO
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Mailbox.h"
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+void SIO_IRQ_PROC0(void);
+void SIO_IRQ_PROC1(void);
+static void RP2040_MailboxIsr(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* Handlers of each core, indexed by message type */
+static volatile Mailbox_HandlerType Mailbox_Handlers[MAILBOX_NB_OF_CORES][MAILBOX_NB_OF_TYPES];
+
+/* Statistics of each core (only written by that core) */
+static volatile Mailbox_StatsType Mailbox_Stats[MAILBOX_NB_OF_CORES];
+
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_MailboxInit function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   To be called on each receiving core, once the launch protocol has released the
+///         FIFO (RP2040_StartCore1 and the dual-core RAM initialization poll it directly).
+///         The messages are dispatched when the interrupts of the core are enabled.
+//-----------------------------------------------------------------------------------------
+void RP2040_MailboxInit(void)
+{
+  const uint32 IrqMask = 1UL << ((uint32)SIO_IRQ_PROC0_IRQn + SIO->CPUID);
+
+  /* Clear the sticky error flags of this core */
+  SIO->FIFO_ST.reg = SIO_FIFO_ST_ROE_Msk | SIO_FIFO_ST_WOF_Msk;
+
+  NVIC->ICPR[0] = IrqMask;
+  NVIC->ISER[0] = IrqMask;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_MailboxRegister function
+///
+/// \param  Type    : message type (0 .. MAILBOX_NB_OF_TYPES - 1)
+///         Handler : called on the calling core for each message of this type (NULL_PTR: none)
+///
+/// \return TRUE if the type is valid
+//-----------------------------------------------------------------------------------------
+boolean RP2040_MailboxRegister(uint32 Type, Mailbox_HandlerType Handler)
+{
+  if(Type >= MAILBOX_NB_OF_TYPES)
+  {
+    return(FALSE);
+  }
+
+  Mailbox_Handlers[SIO->CPUID][Type] = Handler;
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_MailboxSend function
+///
+/// \param  Type    : message type (0 .. MAILBOX_NB_OF_TYPES - 1)
+///         Payload : 24-bit payload
+///
+/// \return TRUE if the message is in the FIFO, FALSE if the FIFO is full or the message invalid
+///
+/// \note   Never blocks, callable from thread and interrupt level.
+//-----------------------------------------------------------------------------------------
+boolean RP2040_MailboxSend(uint32 Type, uint32 Payload)
+{
+  volatile Mailbox_StatsType* const pStats = &Mailbox_Stats[SIO->CPUID];
+  boolean boResult = FALSE;
+  uint32 Primask;
+
+  if((Type >= MAILBOX_NB_OF_TYPES) || (Payload > MAILBOX_PAYLOAD_MSK))
+  {
+    return(FALSE);
+  }
+
+  /* The handlers of this core may send too: the FIFO check and the counters are not preempted */
+  Primask = __get_PRIMASK();
+  __asm volatile("CPSID i" ::: "memory");
+
+  if((SIO->FIFO_ST.reg & SIO_FIFO_ST_RDY_Msk) != 0UL)
+  {
+    SIO->FIFO_WR = MAILBOX_MSG(Type, Payload);
+    pStats->u32Sent++;
+    boResult = TRUE;
+  }
+  else
+  {
+    pStats->u32TxFull++;
+  }
+
+  __set_PRIMASK(Primask);
+
+  /* Wake the other core if it waits for an event */
+  if(boResult == TRUE)
+  {
+    __asm volatile("SEV");
+  }
+
+  return(boResult);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_MailboxGetStats function
+///
+/// \param  CpuId  : core of the statistics (CPU_COREx_ID)
+///         pStats : copy of the statistics
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_MailboxGetStats(uint32 CpuId, Mailbox_StatsType* pStats)
+{
+  if((CpuId < MAILBOX_NB_OF_CORES) && (pStats != NULL_PTR))
+  {
+    pStats->u32Sent      = Mailbox_Stats[CpuId].u32Sent;
+    pStats->u32Received  = Mailbox_Stats[CpuId].u32Received;
+    pStats->u32TxFull    = Mailbox_Stats[CpuId].u32TxFull;
+    pStats->u32Wof       = Mailbox_Stats[CpuId].u32Wof;
+    pStats->u32Roe       = Mailbox_Stats[CpuId].u32Roe;
+    pStats->u32Unhandled = Mailbox_Stats[CpuId].u32Unhandled;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SIO_IRQ_PROC0 function (FIFO interrupt of core 0)
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void SIO_IRQ_PROC0(void)
+{
+  RP2040_MailboxIsr();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SIO_IRQ_PROC1 function (FIFO interrupt of core 1)
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void SIO_IRQ_PROC1(void)
+{
+  RP2040_MailboxIsr();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_MailboxIsr function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   The FIFO interrupt is raised while the RX FIFO holds data or an error flag is set:
+///         the errors are counted and cleared, then the RX FIFO is drained.
+//-----------------------------------------------------------------------------------------
+static void RP2040_MailboxIsr(void)
+{
+  const uint32 CpuId = SIO->CPUID;
+  volatile Mailbox_StatsType* const pStats = &Mailbox_Stats[CpuId];
+  const uint32 Status = SIO->FIFO_ST.reg;
+
+  if((Status & SIO_FIFO_ST_WOF_Msk) != 0UL)
+  {
+    pStats->u32Wof++;
+  }
+
+  if((Status & SIO_FIFO_ST_ROE_Msk) != 0UL)
+  {
+    pStats->u32Roe++;
+  }
+
+  if((Status & (SIO_FIFO_ST_ROE_Msk | SIO_FIFO_ST_WOF_Msk)) != 0UL)
+  {
+    SIO->FIFO_ST.reg = SIO_FIFO_ST_ROE_Msk | SIO_FIFO_ST_WOF_Msk;
+  }
+
+  while((SIO->FIFO_ST.reg & SIO_FIFO_ST_VLD_Msk) != 0UL)
+  {
+    const uint32 Msg  = SIO->FIFO_RD;
+    const uint32 Type = MAILBOX_MSG_TYPE(Msg);
+    const Mailbox_HandlerType Handler = (Type < MAILBOX_NB_OF_TYPES) ? Mailbox_Handlers[CpuId][Type] : NULL_PTR;
+
+    pStats->u32Received++;
+
+    if(Handler != NULL_PTR)
+    {
+      Handler(MAILBOX_MSG_PAYLOAD(Msg));
+    }
+    else
+    {
+      pStats->u32Unhandled++;
+    }
+  }
+}
@@ -0,0 +1,68 @@
+/******************************************************************************************
+  Filename    : Mailbox.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Inter-core mailbox over the SIO FIFO header file
+  
+******************************************************************************************/
+#ifndef __RP2040_MAILBOX_H__
+#define __RP2040_MAILBOX_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define MAILBOX_NB_OF_CORES        2UL
+
+/* Message types dispatched to the handlers of the receiving core */
+#ifndef MAILBOX_NB_OF_TYPES
+  #define MAILBOX_NB_OF_TYPES      16UL
+#endif
+
+/* Message layout: [31:24] type, [23:0] payload */
+#define MAILBOX_TYPE_POS           24UL
+#define MAILBOX_PAYLOAD_MSK        0x00FFFFFFUL
+
+#define MAILBOX_MSG(type, payload) ((((uint32)(type)) << MAILBOX_TYPE_POS) | (((uint32)(payload)) & MAILBOX_PAYLOAD_MSK))
+#define MAILBOX_MSG_TYPE(msg)      ((uint32)(msg) >> MAILBOX_TYPE_POS)
+#define MAILBOX_MSG_PAYLOAD(msg)   ((uint32)(msg) & MAILBOX_PAYLOAD_MSK)
+
+//=============================================================================
+// Types definition
+//=============================================================================
+/* Called from SIO_IRQ_PROCn of the receiving core */
+typedef void (*Mailbox_HandlerType)(uint32 u32Payload);
+
+typedef struct
+{
+  uint32 u32Sent;
+  uint32 u32Received;
+  uint32 u32TxFull;      /* RP2040_MailboxSend refused: TX FIFO full (overflow)  */
+  uint32 u32Wof;         /* FIFO_ST.WOF: write to the full TX FIFO               */
+  uint32 u32Roe;         /* FIFO_ST.ROE: read from the empty RX FIFO             */
+  uint32 u32Unhandled;   /* no handler registered for the message type           */
+}Mailbox_StatsType;
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+void RP2040_MailboxInit(void);
+boolean RP2040_MailboxRegister(uint32 Type, Mailbox_HandlerType Handler);
+boolean RP2040_MailboxSend(uint32 Type, uint32 Payload);
+void RP2040_MailboxGetStats(uint32 CpuId, Mailbox_StatsType* pStats);
+
+#endif /*__RP2040_MAILBOX_H__*/
@@ -0,0 +1,414 @@
+/******************************************************************************************
+  Filename    : Power.c
+
+  Core        : ARM Cortex-M0+
+
+  MCU         : RP2040
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Sleep and dormant mode manager for RP2040
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Power.h"
+#include "Clock.h"
+#include "Timer.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+
+/* IO_BANK0 interrupt registers: 8 GPIOs per register, 4 event bits per GPIO */
+#define POWER_GPIO_REG_INDEX(pin)   ((pin) / 8UL)
+#define POWER_GPIO_SHIFT(pin)       (4UL * ((pin) % 8UL))
+
+/* CLK_REF_SELECTED is one-hot on the SRC field */
+#define POWER_CLK_REF_SELECTED_ROSC (1UL << CLOCKS_CLK_REF_CTRL_SRC_rosc_clksrc_ph)
+#define POWER_CLK_REF_SELECTED_XOSC (1UL << CLOCKS_CLK_REF_CTRL_SRC_xosc_clksrc)
+#define POWER_CLK_SYS_SELECTED_REF  (1UL << CLOCKS_CLK_SYS_CTRL_SRC_clk_ref)
+
+#define POWER_PLL_PWR_ALL_DOWN      (PLL_SYS_PWR_PD_Msk | PLL_SYS_PWR_DSMPD_Msk | PLL_SYS_PWR_POSTDIVPD_Msk | PLL_SYS_PWR_VCOPD_Msk)
+
+#define POWER_SECONDS_PER_DAY       86400UL
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+static uint32 RP2040_PowerSleep(const Power_WakeCfgType* pWake, uint64* pResume);
+static uint32 RP2040_PowerDormant(uint32 Mode, const Power_WakeCfgType* pWake, uint64* pResume);
+static void RP2040_PowerGpioWake(const Power_WakeCfgType* pWake, volatile uint32_t* pInte, boolean boEnable);
+static void RP2040_PowerRtcWake(uint32 Seconds);
+static uint32 RP2040_PowerXoscStartupUs(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+static volatile Power_StatsType Power_Stats;
+
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_PowerEnter function
+///
+/// \param  Mode  : POWER_MODE_xxx
+///         pWake : wake sources, at least one must be selected
+///
+/// \return TRUE after the wakeup, FALSE if the request is invalid (nothing changed)
+///
+/// \note   The caller must leave the other core idle (or stopped): a clock change
+///         is not visible to its timing, and SLEEP only gates the clocks when both
+///         cores are in deep sleep.
+//-----------------------------------------------------------------------------------------
+boolean RP2040_PowerEnter(uint32 Mode, const Power_WakeCfgType* pWake)
+{
+  uint32 Token;
+  uint32 OscStartupUs;
+  uint32 Latency;
+  uint64 Resume;
+
+  if((pWake == NULL_PTR) || (Mode > POWER_MODE_DORMANT_ROSC))
+  {
+    return(FALSE);
+  }
+
+  /* No wake source: the core would never come back */
+  if((pWake->u32Sources == 0UL) || ((pWake->u32Sources & ~(POWER_WAKE_GPIO | POWER_WAKE_RTC)) != 0UL))
+  {
+    return(FALSE);
+  }
+
+  if(((pWake->u32Sources & POWER_WAKE_GPIO) != 0UL) &&
+     ((pWake->u32GpioPin >= POWER_NB_OF_GPIOS) || (pWake->u32GpioEvents == 0UL) || (pWake->u32GpioEvents > 0x0FUL)))
+  {
+    return(FALSE);
+  }
+
+  if(((pWake->u32Sources & POWER_WAKE_RTC) != 0UL) &&
+     ((Mode != POWER_MODE_SLEEP) || (pWake->u32RtcSeconds == 0UL) || (pWake->u32RtcSeconds > POWER_RTC_MAX_SECONDS)))
+  {
+    return(FALSE);
+  }
+
+  /* The wake latency is measured with the TIMER */
+  if(RESETS->RESET_DONE.bit.timer == 0U)
+  {
+    RP2040_TimerInit();
+  }
+
+  /* The power transitions rebuild the clock tree, take the DFS lock with the interrupts masked: the wake interrupts only end the WFI/pause,
+     their handlers never run */
+  Token = RP2040_SpinlockAcquire(CLOCK_DFS_SPINLOCK, TRUE);
+
+  if(Mode == POWER_MODE_SLEEP)
+  {
+    OscStartupUs = RP2040_PowerSleep(pWake, &Resume);
+  }
+  else
+  {
+    OscStartupUs = RP2040_PowerDormant(Mode, pWake, &Resume);
+  }
+
+  /* The TIMER is stopped while the oscillator restarts, add its startup time */
+  Latency = (uint32)(RP2040_TimerGetTime() - Resume) + OscStartupUs;
+
+  Power_Stats.u32OscStartupUs      = OscStartupUs;
+  Power_Stats.u32LastWakeLatencyUs = Latency;
+
+  if(Latency > Power_Stats.u32MaxWakeLatencyUs)
+  {
+    Power_Stats.u32MaxWakeLatencyUs = Latency;
+  }
+
+  RP2040_SpinlockRelease(CLOCK_DFS_SPINLOCK, Token);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_PowerGetStats function
+///
+/// \param  pStats : copy of the wake statistics
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_PowerGetStats(Power_StatsType* pStats)
+{
+  if(pStats != NULL_PTR)
+  {
+    pStats->u32OscStartupUs      = Power_Stats.u32OscStartupUs;
+    pStats->u32LastWakeLatencyUs = Power_Stats.u32LastWakeLatencyUs;
+    pStats->u32MaxWakeLatencyUs  = Power_Stats.u32MaxWakeLatencyUs;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_PowerSleep function
+///
+/// \param  pWake   : wake sources
+///         pResume : TIMER value at the wakeup
+///
+/// \return oscillator startup time (us), always 0: the oscillators keep running
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_PowerSleep(const Power_WakeCfgType* pWake, uint64* pResume)
+{
+  const uint32 SavedEn0 = CLOCKS->SLEEP_EN0.reg;
+  const uint32 SavedEn1 = CLOCKS->SLEEP_EN1.reg;
+  volatile uint32_t* const pInte = (SIO->CPUID == 0UL) ? &IO_BANK0->PROC0_INTE0.reg : &IO_BANK0->PROC1_INTE0.reg;
+  Clock_GateProfileType Profile;
+  uint32 SleepEn0 = 0UL;
+  uint32 SleepEn1 = 0UL;
+  uint32 IrqMask  = 0UL;
+
+  /* Blocks kept running in sleep by the gating profile */
+  if(RP2040_ClockGateGetProfile(&Profile) == TRUE)
+  {
+    SleepEn0 = Profile.u32SleepEn0;
+    SleepEn1 = Profile.u32SleepEn1;
+  }
+
+  if((pWake->u32Sources & POWER_WAKE_GPIO) != 0UL)
+  {
+    RP2040_PowerGpioWake(pWake, pInte, TRUE);
+    SleepEn0 |= POWER_SLEEP_EN0_GPIO;
+    IrqMask  |= (1UL << (uint32)IO_IRQ_BANK0_IRQn);
+  }
+
+  if((pWake->u32Sources & POWER_WAKE_RTC) != 0UL)
+  {
+    RP2040_PowerRtcWake(pWake->u32RtcSeconds);
+    SleepEn0 |= POWER_SLEEP_EN0_RTC;
+    IrqMask  |= (1UL << (uint32)RTC_IRQ_IRQn);
+  }
+
+  /* WFI wakes up on an enabled pending interrupt even with PRIMASK set,
+     the interrupts already enabled by the application stay enabled afterwards */
+  const uint32 IrqEnabled = NVIC->ISER[0] & IrqMask;
+
+  NVIC->ICPR[0] = IrqMask;
+  NVIC->ISER[0] = IrqMask;
+
+  /* Keep only the clocks of the wake sources and of the profile */
+  CLOCKS->SLEEP_EN0.reg = SleepEn0;
+  CLOCKS->SLEEP_EN1.reg = SleepEn1;
+
+  SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+  __asm volatile("DSB" ::: "memory");
+  __asm volatile("WFI");
+  SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+  *pResume = RP2040_TimerGetTime();
+
+  CLOCKS->SLEEP_EN0.reg = SavedEn0;
+  CLOCKS->SLEEP_EN1.reg = SavedEn1;
+
+  /* Disarm the wake sources */
+  if((pWake->u32Sources & POWER_WAKE_GPIO) != 0UL)
+  {
+    RP2040_PowerGpioWake(pWake, pInte, FALSE);
+  }
+
+  if((pWake->u32Sources & POWER_WAKE_RTC) != 0UL)
+  {
+    RTC->INTE.reg        = 0UL;
+    RTC->IRQ_SETUP_0.reg = 0UL;
+  }
+
+  NVIC->ICER[0] = IrqMask & ~IrqEnabled;
+  NVIC->ICPR[0] = IrqMask;
+
+  return(0UL);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_PowerDormant function
+///
+/// \param  Mode    : POWER_MODE_DORMANT_XOSC or POWER_MODE_DORMANT_ROSC
+///         pWake   : wake sources (GPIO only)
+///         pResume : TIMER value once the oscillator runs again
+///
+/// \return oscillator startup time (us)
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_PowerDormant(uint32 Mode, const Power_WakeCfgType* pWake, uint64* pResume)
+{
+  Clock_ConfigType Config;
+  uint32 OscStartupUs;
+
+  RP2040_ClockSaveConfig(&Config);
+
+  /* Run clk_ref and clk_sys from the oscillator that is paused */
+  if(Mode == POWER_MODE_DORMANT_ROSC)
+  {
+    CLOCKS->CLK_REF_CTRL.bit.SRC = CLOCKS_CLK_REF_CTRL_SRC_rosc_clksrc_ph;
+    while(CLOCKS->CLK_REF_SELECTED != POWER_CLK_REF_SELECTED_ROSC);
+  }
+  else
+  {
+    CLOCKS->CLK_REF_CTRL.bit.SRC = CLOCKS_CLK_REF_CTRL_SRC_xosc_clksrc;
+    while(CLOCKS->CLK_REF_SELECTED != POWER_CLK_REF_SELECTED_XOSC);
+  }
+
+  RP2040_TimerUpdateTick();
+
+  CLOCKS->CLK_SYS_CTRL.bit.SRC = CLOCKS_CLK_SYS_CTRL_SRC_clk_ref;
+  while(CLOCKS->CLK_SYS_SELECTED != POWER_CLK_SYS_SELECTED_REF);
+
+  /* Stop the auxiliary generators and the PLLs */
+  CLOCKS->CLK_PERI_CTRL.bit.ENABLE = 0U;
+  CLOCKS->CLK_USB_CTRL.bit.ENABLE  = 0U;
+  CLOCKS->CLK_ADC_CTRL.bit.ENABLE  = 0U;
+  CLOCKS->CLK_RTC_CTRL.bit.ENABLE  = 0U;
+
+  PLL_SYS->PWR.reg = POWER_PLL_PWR_ALL_DOWN;
+  PLL_USB->PWR.reg = POWER_PLL_PWR_ALL_DOWN;
+
+  /* Stop the oscillator that is not paused, the chip reaches the low-power state only
+     with both oscillators stopped */
+  if(Mode == POWER_MODE_DORMANT_ROSC)
+  {
+    XOSC->CTRL.bit.ENABLE = XOSC_CTRL_ENABLE_DISABLE;
+  }
+  else
+  {
+    ROSC->CTRL.bit.ENABLE = ROSC_CTRL_ENABLE_DISABLE;
+  }
+
+  RP2040_PowerGpioWake(pWake, &IO_BANK0->DORMANT_WAKE_INTE0.reg, TRUE);
+
+  /* Pause the oscillator: execution stops here until the GPIO event */
+  __asm volatile("DSB" ::: "memory");
+
+  if(Mode == POWER_MODE_DORMANT_ROSC)
+  {
+    ROSC->DORMANT = POWER_DORMANT_COMMAND;
+    OscStartupUs  = 0UL;
+  }
+  else
+  {
+    XOSC->DORMANT = POWER_DORMANT_COMMAND;
+    while(XOSC->STATUS.bit.STABLE != 1U);
+    OscStartupUs  = RP2040_PowerXoscStartupUs();
+  }
+
+  *pResume = RP2040_TimerGetTime();
+
+  RP2040_PowerGpioWake(pWake, &IO_BANK0->DORMANT_WAKE_INTE0.reg, FALSE);
+
+  /* Restart the other oscillator, the PLLs and the generators */
+  RP2040_ClockRestoreConfig(&Config);
+
+  return(OscStartupUs);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_PowerGpioWake function
+///
+/// \param  pWake    : GPIO pin and events
+///         pInte    : first interrupt enable register of the target (PROCn or DORMANT_WAKE)
+///         boEnable : arm (TRUE) or disarm (FALSE) the GPIO events
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_PowerGpioWake(const Power_WakeCfgType* pWake, volatile uint32_t* pInte, boolean boEnable)
+{
+  const uint32 Index = POWER_GPIO_REG_INDEX(pWake->u32GpioPin);
+  const uint32 Mask  = pWake->u32GpioEvents << POWER_GPIO_SHIFT(pWake->u32GpioPin);
+
+  /* Clear the latched edges (the level events are not latched) */
+  (&IO_BANK0->INTR0.reg)[Index] = Mask;
+
+  if(boEnable == TRUE)
+  {
+    pInte[Index] |= Mask;
+  }
+  else
+  {
+    pInte[Index] &= ~Mask;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_PowerRtcWake function
+///
+/// \param  Seconds : delay before the alarm (1 second resolution)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_PowerRtcWake(uint32 Seconds)
+{
+  uint32 Now;
+  uint32 Alarm;
+
+  /* The RTC may have been gated by the clock-gating profile */
+  CLOCKS->WAKE_EN0.reg |= POWER_SLEEP_EN0_RTC | CLOCKS_WAKE_EN0_clk_sys_rtc_Msk;
+
+  /* clk_rtc from the XOSC */
+  if(CLOCKS->CLK_RTC_CTRL.bit.ENABLE == 0U)
+  {
+    CLOCKS->CLK_RTC_CTRL.bit.AUXSRC = CLOCKS_CLK_RTC_CTRL_AUXSRC_xosc_clksrc;
+    CLOCKS->CLK_RTC_DIV.reg         = POWER_RTC_CLK_DIV << CLOCKS_CLK_RTC_DIV_INT_Pos;
+    CLOCKS->CLK_RTC_CTRL.bit.ENABLE = 1U;
+  }
+
+  if(RESETS->RESET_DONE.bit.rtc == 0U)
+  {
+    RESETS->RESET.bit.rtc = 0U;
+    while(RESETS->RESET_DONE.bit.rtc == 0U);
+  }
+
+  /* Start the RTC at an arbitrary date if nobody did, only the time of day is used */
+  if(RTC->CTRL.bit.RTC_ACTIVE == 0U)
+  {
+    RTC->CLKDIV_M1.reg = (CLOCK_XOSC_FREQ_HZ / POWER_RTC_CLK_DIV) - 1UL;
+    RTC->SETUP_0.reg   = (2026UL << RTC_SETUP_0_YEAR_Pos) | (1UL << RTC_SETUP_0_MONTH_Pos) | (1UL << RTC_SETUP_0_DAY_Pos);
+    RTC->SETUP_1.reg   = 0UL;
+    RTC->CTRL.reg      = RTC_CTRL_LOAD_Msk;
+    RTC->CTRL.reg      = RTC_CTRL_RTC_ENABLE_Msk;
+    while(RTC->CTRL.bit.RTC_ACTIVE == 0U);
+  }
+
+  Now = RTC->RTC_0.reg;
+  Now = (((Now & RTC_RTC_0_HOUR_Msk) >> RTC_RTC_0_HOUR_Pos) * 3600UL)
+      + (((Now & RTC_RTC_0_MIN_Msk)  >> RTC_RTC_0_MIN_Pos)  * 60UL)
+      +  ((Now & RTC_RTC_0_SEC_Msk)  >> RTC_RTC_0_SEC_Pos);
+
+  Alarm = (Now + Seconds) % POWER_SECONDS_PER_DAY;
+
+  /* The match value can only be changed with the alarm disabled */
+  RTC->IRQ_SETUP_0.reg = 0UL;
+  while((RTC->IRQ_SETUP_0.reg & RTC_IRQ_SETUP_0_MATCH_ACTIVE_Msk) != 0UL);
+
+  RTC->IRQ_SETUP_1.reg = RTC_IRQ_SETUP_1_HOUR_ENA_Msk | RTC_IRQ_SETUP_1_MIN_ENA_Msk | RTC_IRQ_SETUP_1_SEC_ENA_Msk
+                       | ((Alarm / 3600UL)          << RTC_IRQ_SETUP_1_HOUR_Pos)
+                       | (((Alarm / 60UL) % 60UL)   << RTC_IRQ_SETUP_1_MIN_Pos)
+                       | ((Alarm % 60UL)            << RTC_IRQ_SETUP_1_SEC_Pos);
+
+  RTC->IRQ_SETUP_0.reg = RTC_IRQ_SETUP_0_MATCH_ENA_Msk;
+  RTC->INTE.reg        = RTC_INTE_RTC_Msk;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_PowerXoscStartupUs function
+///
+/// \param  void
+///
+/// \return XOSC startup time (us) programmed in STARTUP (DELAY x 256 cycles, x4 if X4)
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_PowerXoscStartupUs(void)
+{
+  const uint32 Startup = XOSC->STARTUP.reg;
+  uint32 Cycles        = ((Startup & XOSC_STARTUP_DELAY_Msk) >> XOSC_STARTUP_DELAY_Pos) * 256UL;
+
+  if((Startup & XOSC_STARTUP_X4_Msk) != 0UL)
+  {
+    Cycles *= 4UL;
+  }
+
+  return(Cycles / (CLOCK_XOSC_FREQ_HZ / 1000000UL));
+}
@@ -0,0 +1,82 @@
+/******************************************************************************************
+  Filename    : Power.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Sleep and dormant mode manager header file for RP2040
+  
+******************************************************************************************/
+#ifndef __RP2040_POWER_H__
+#define __RP2040_POWER_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* Low-power modes */
+#define POWER_MODE_SLEEP              0UL  /* clocks gated (SLEEP_EN), clock tree kept    */
+#define POWER_MODE_DORMANT_XOSC       1UL  /* all clocks stopped, restart on the XOSC     */
+#define POWER_MODE_DORMANT_ROSC       2UL  /* all clocks stopped, restart on the ROSC     */
+
+/* Wake sources (Power_WakeCfgType.u32Sources) */
+#define POWER_WAKE_GPIO               (1UL << 0)
+#define POWER_WAKE_RTC                (1UL << 1)  /* SLEEP only: the RTC has no clock in DORMANT */
+
+/* GPIO wake events (IO_BANK0 interrupt encoding) */
+#define POWER_GPIO_LEVEL_LOW          (1UL << 0)
+#define POWER_GPIO_LEVEL_HIGH         (1UL << 1)
+#define POWER_GPIO_EDGE_LOW           (1UL << 2)
+#define POWER_GPIO_EDGE_HIGH          (1UL << 3)
+
+#define POWER_NB_OF_GPIOS             30UL
+#define POWER_RTC_MAX_SECONDS         86399UL
+
+/* Oscillator pause commands */
+#define POWER_DORMANT_COMMAND         0x636F6D61UL /* "coma" */
+
+/* Clocks left running in SLEEP for each wake source */
+#define POWER_SLEEP_EN0_GPIO          (CLOCKS_SLEEP_EN0_clk_sys_io_Msk | CLOCKS_SLEEP_EN0_clk_sys_pads_Msk)
+#define POWER_SLEEP_EN0_RTC           (CLOCKS_SLEEP_EN0_clk_rtc_rtc_Msk)
+
+/* clk_rtc = XOSC / 256 (46875 Hz with a 12 MHz crystal) */
+#define POWER_RTC_CLK_DIV             256UL
+
+//=============================================================================
+// Types definition
+//=============================================================================
+typedef struct
+{
+  uint32 u32Sources;     /* POWER_WAKE_xxx                           */
+  uint32 u32GpioPin;     /* GPIO number (POWER_WAKE_GPIO)            */
+  uint32 u32GpioEvents;  /* POWER_GPIO_xxx                           */
+  uint32 u32RtcSeconds;  /* delay before the alarm (POWER_WAKE_RTC)  */
+}Power_WakeCfgType;
+
+typedef struct
+{
+  uint32 u32OscStartupUs;        /* oscillator restart (dormant), counted by the oscillator */
+  uint32 u32LastWakeLatencyUs;   /* oscillator restart + clock tree restore                 */
+  uint32 u32MaxWakeLatencyUs;
+}Power_StatsType;
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+boolean RP2040_PowerEnter(uint32 Mode, const Power_WakeCfgType* pWake);
+void RP2040_PowerGetStats(Power_StatsType* pStats);
+
+#endif /*__RP2040_POWER_H__*/
@@ -0,0 +1,254 @@
+/******************************************************************************************
+  Filename    : Ring.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Lock-free single-producer/single-consumer ring buffer
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Ring.h"
+#include "Mailbox.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define RING_MIN(a, b)  (((a) < (b)) ? (a) : (b))
+
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingInit function
+///
+/// \param  pRing        : ring to initialize (before both sides use it)
+///         pBuffer      : Size words of shared SRAM
+///         Size         : number of words, power of 2
+///         DoorbellType : mailbox message type sent when the ring becomes non-empty
+///                        (RING_NO_DOORBELL: SEV only)
+///
+/// \return TRUE if the parameters are valid
+//-----------------------------------------------------------------------------------------
+boolean RP2040_RingInit(Ring_Type* pRing, uint32* pBuffer, uint32 Size, uint32 DoorbellType)
+{
+  if((pRing == NULL_PTR) || (pBuffer == NULL_PTR) || (Size == 0UL) || ((Size & (Size - 1UL)) != 0UL))
+  {
+    return(FALSE);
+  }
+
+  pRing->pBuffer         = pBuffer;
+  pRing->u32Size         = Size;
+  pRing->u32Mask         = Size - 1UL;
+  pRing->u32DoorbellType = DoorbellType;
+  pRing->u32Head         = 0UL;
+  pRing->u32Tail         = 0UL;
+
+  __asm volatile("DMB" ::: "memory");
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingReserve function (producer)
+///
+/// \param  pRing   : ring
+///         ppSlots : first reserved slot, written in place (zero-copy)
+///         Count   : number of slots wanted
+///
+/// \return number of contiguous slots reserved (up to Count, 0 if the ring is full)
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_RingReserve(Ring_Type* pRing, uint32** ppSlots, uint32 Count)
+{
+  const uint32 Head = pRing->u32Head;
+  const uint32 Tail = pRing->u32Tail;
+  const uint32 Free = pRing->u32Size - (Head - Tail);
+  const uint32 Contiguous = pRing->u32Size - (Head & pRing->u32Mask);
+
+  /* The slots released by the consumer are free only once its reads are complete */
+  __asm volatile("DMB" ::: "memory");
+
+  *ppSlots = &pRing->pBuffer[Head & pRing->u32Mask];
+
+  return(RING_MIN(Count, RING_MIN(Free, Contiguous)));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingCommit function (producer)
+///
+/// \param  pRing : ring
+///         Count : number of reserved slots written
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_RingCommit(Ring_Type* pRing, uint32 Count)
+{
+  const uint32 Head = pRing->u32Head;
+
+  if(Count == 0UL)
+  {
+    return;
+  }
+
+  /* Publish the data before the index */
+  __asm volatile("DMB" ::: "memory");
+  pRing->u32Head = Head + Count;
+
+  /* Wake a consumer waiting in WFE */
+  __asm volatile("DSB" ::: "memory");
+  __asm volatile("SEV");
+
+  /* Tail is read after Head is published (DSB above): a consumer that released the last
+     slot meanwhile either sees the new Head or is seen here as empty and gets the doorbell */
+  if((pRing->u32Tail == Head) && (pRing->u32DoorbellType != RING_NO_DOORBELL))
+  {
+    /* A full mailbox already holds a pending doorbell */
+    (void)RP2040_MailboxSend(pRing->u32DoorbellType, 0UL);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingWrite function (producer)
+///
+/// \param  pRing : ring
+///         pData : words to copy into the ring
+///         Count : number of words
+///
+/// \return number of words written (less than Count if the ring is full)
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_RingWrite(Ring_Type* pRing, const uint32* pData, uint32 Count)
+{
+  uint32 Written = 0UL;
+
+  /* At most two chunks: up to the end of the buffer, then from its start */
+  for(uint32 Chunk = 0UL; (Chunk < 2UL) && (Written < Count); Chunk++)
+  {
+    uint32* pSlots;
+    const uint32 Reserved = RP2040_RingReserve(pRing, &pSlots, Count - Written);
+
+    for(uint32 idx = 0UL; idx < Reserved; idx++)
+    {
+      pSlots[idx] = pData[Written + idx];
+    }
+
+    RP2040_RingCommit(pRing, Reserved);
+    Written += Reserved;
+  }
+
+  return(Written);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingWaitSpace function (producer)
+///
+/// \param  pRing : ring
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_RingWaitSpace(const Ring_Type* pRing)
+{
+  while((pRing->u32Head - pRing->u32Tail) == pRing->u32Size)
+  {
+    __asm volatile("WFE");
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingPeek function (consumer)
+///
+/// \param  pRing   : ring
+///         ppSlots : first readable slot, read in place (zero-copy)
+///         Count   : number of slots wanted
+///
+/// \return number of contiguous slots readable (up to Count, 0 if the ring is empty)
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_RingPeek(Ring_Type* pRing, const uint32** ppSlots, uint32 Count)
+{
+  const uint32 Tail = pRing->u32Tail;
+  const uint32 Used = pRing->u32Head - Tail;
+  const uint32 Contiguous = pRing->u32Size - (Tail & pRing->u32Mask);
+
+  /* The data is read only after the index that published it */
+  __asm volatile("DMB" ::: "memory");
+
+  *ppSlots = &pRing->pBuffer[Tail & pRing->u32Mask];
+
+  return(RING_MIN(Count, RING_MIN(Used, Contiguous)));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingRelease function (consumer)
+///
+/// \param  pRing : ring
+///         Count : number of peeked slots consumed
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_RingRelease(Ring_Type* pRing, uint32 Count)
+{
+  if(Count == 0UL)
+  {
+    return;
+  }
+
+  /* Complete the reads before handing the slots back */
+  __asm volatile("DMB" ::: "memory");
+  pRing->u32Tail = pRing->u32Tail + Count;
+
+  /* Wake a producer waiting for space */
+  __asm volatile("DSB" ::: "memory");
+  __asm volatile("SEV");
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingRead function (consumer)
+///
+/// \param  pRing : ring
+///         pData : destination of the words
+///         Count : number of words wanted
+///
+/// \return number of words read (less than Count if the ring is empty)
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_RingRead(Ring_Type* pRing, uint32* pData, uint32 Count)
+{
+  uint32 Read = 0UL;
+
+  for(uint32 Chunk = 0UL; (Chunk < 2UL) && (Read < Count); Chunk++)
+  {
+    const uint32* pSlots;
+    const uint32 Available = RP2040_RingPeek(pRing, &pSlots, Count - Read);
+
+    for(uint32 idx = 0UL; idx < Available; idx++)
+    {
+      pData[Read + idx] = pSlots[idx];
+    }
+
+    RP2040_RingRelease(pRing, Available);
+    Read += Available;
+  }
+
+  return(Read);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_RingWaitData function (consumer)
+///
+/// \param  pRing : ring
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_RingWaitData(const Ring_Type* pRing)
+{
+  while(pRing->u32Head == pRing->u32Tail)
+  {
+    __asm volatile("WFE");
+  }
+}
@@ -0,0 +1,66 @@
+/******************************************************************************************
+  Filename    : Ring.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Lock-free single-producer/single-consumer ring buffer header file
+  
+******************************************************************************************/
+#ifndef __RP2040_RING_H__
+#define __RP2040_RING_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* No FIFO doorbell (RP2040_RingInit DoorbellType) */
+#define RING_NO_DOORBELL           0xFFFFFFFFUL
+
+//=============================================================================
+// Types definition
+//=============================================================================
+/* The producer only writes u32Head, the consumer only writes u32Tail. Both indexes run
+   freely (modulo 2^32) and are masked on access. The M0+ has no data cache: the indexes are
+   kept in separate words (different SRAM stripes) and the buffer is word-aligned. */
+typedef struct
+{
+  uint32*         pBuffer;         /* u32Size words                               */
+  uint32          u32Size;         /* power of 2                                  */
+  uint32          u32Mask;         /* u32Size - 1                                 */
+  uint32          u32DoorbellType; /* mailbox type sent on empty -> non-empty     */
+  volatile uint32 u32Head;         /* next slot written by the producer           */
+  volatile uint32 u32Tail;         /* next slot read by the consumer              */
+}Ring_Type;
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+boolean RP2040_RingInit(Ring_Type* pRing, uint32* pBuffer, uint32 Size, uint32 DoorbellType);
+
+/* Producer */
+uint32 RP2040_RingReserve(Ring_Type* pRing, uint32** ppSlots, uint32 Count);
+void RP2040_RingCommit(Ring_Type* pRing, uint32 Count);
+uint32 RP2040_RingWrite(Ring_Type* pRing, const uint32* pData, uint32 Count);
+void RP2040_RingWaitSpace(const Ring_Type* pRing);
+
+/* Consumer */
+uint32 RP2040_RingPeek(Ring_Type* pRing, const uint32** ppSlots, uint32 Count);
+void RP2040_RingRelease(Ring_Type* pRing, uint32 Count);
+uint32 RP2040_RingRead(Ring_Type* pRing, uint32* pData, uint32 Count);
+void RP2040_RingWaitData(const Ring_Type* pRing);
+
+#endif /*__RP2040_RING_H__*/
@@ -0,0 +1,376 @@
+/******************************************************************************************
+  Filename    : Spinlock.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : SIO hardware spinlock API for RP2040
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Spinlock.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+/* Reading a spinlock claims it (0: already claimed), writing any value releases it */
+#define SPINLOCK_REG(id)          (*((volatile uint32*)(&SIO->SPINLOCK0) + (id)))
+
+/* Release token: PRIMASK before the acquisition and whether it was masked by the acquisition */
+#define SPINLOCK_TOKEN_PRIMASK    0x01UL
+#define SPINLOCK_TOKEN_MASKED     0x02UL
+
+#define SPINLOCK_NO_OWNER         0UL
+#define SPINLOCK_OWNER(cpu)       ((cpu) + 1UL)
+
+//=============================================================================
+// Globals
+//=============================================================================
+/* Only written by the holder, an owner can only match on the core holding the lock */
+static volatile uint32 Spinlock_Owner[SPINLOCK_NB_OF_LOCKS];
+static uint32 Spinlock_Depth[SPINLOCK_NB_OF_LOCKS];
+
+#if (SPINLOCK_STATS == 1)
+static Spinlock_StatsType Spinlock_Stats[SPINLOCK_NB_OF_LOCKS];
+static uint32 Spinlock_HoldStart[SPINLOCK_NB_OF_LOCKS];
+
+/* Sequence count of each statistics record: odd while the holder updates it */
+static volatile uint32 Spinlock_StatsSeq[SPINLOCK_NB_OF_LOCKS];
+#endif
+
+//=============================================================================
+// Static functions prototype
+//=============================================================================
+static uint32 RP2040_SpinlockMask(boolean boMaskIrq);
+static void RP2040_SpinlockTaken(uint32 LockId, uint32 Owner, uint32 Spins);
+
+#if (SPINLOCK_STATS == 1)
+static uint32 RP2040_SpinlockGetTimeUs(void);
+static uint32 RP2040_SpinlockStatsBegin(uint32 LockId);
+static void RP2040_SpinlockStatsEnd(uint32 LockId, uint32 Primask);
+#endif
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockMask static function
+///
+/// \param  boMaskIrq : TRUE to mask the interrupts of the calling core
+///
+/// \return release token
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_SpinlockMask(boolean boMaskIrq)
+{
+  uint32 Token = __get_PRIMASK() & SPINLOCK_TOKEN_PRIMASK;
+
+  if(boMaskIrq == TRUE)
+  {
+    __asm volatile("CPSID i" ::: "memory");
+    Token |= SPINLOCK_TOKEN_MASKED;
+  }
+
+  return(Token);
+}
+
+#if (SPINLOCK_STATS == 1)
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockGetTimeUs static function
+///
+/// \param  void
+///
+/// \return low word of the TIMER (0 while the TIMER is held in reset)
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_SpinlockGetTimeUs(void)
+{
+  return((RESETS->RESET_DONE.bit.timer == 1U) ? TIMER->TIMERAWL : 0UL);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockStatsBegin static function
+///
+/// \param  LockId : lock held by the calling core
+///
+/// \return PRIMASK to pass to RP2040_SpinlockStatsEnd
+///
+/// \note   The update is not interruptible: a reader on the same core never waits for it.
+//-----------------------------------------------------------------------------------------
+static uint32 RP2040_SpinlockStatsBegin(uint32 LockId)
+{
+  const uint32 Primask = __get_PRIMASK();
+
+  __asm volatile("CPSID i" ::: "memory");
+
+  Spinlock_StatsSeq[LockId]++;
+  __asm volatile("DMB" ::: "memory");
+
+  return(Primask);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockStatsEnd static function
+///
+/// \param  LockId  : lock held by the calling core
+///         Primask : value returned by RP2040_SpinlockStatsBegin
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_SpinlockStatsEnd(uint32 LockId, uint32 Primask)
+{
+  __asm volatile("DMB" ::: "memory");
+  Spinlock_StatsSeq[LockId]++;
+
+  __set_PRIMASK(Primask);
+}
+#endif
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockTaken static function
+///
+/// \param  LockId : claimed lock
+///         Owner  : SPINLOCK_OWNER of the calling core
+///         Spins  : failed claims before this one
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RP2040_SpinlockTaken(uint32 LockId, uint32 Owner, uint32 Spins)
+{
+  __asm volatile("DMB" ::: "memory");
+
+  Spinlock_Owner[LockId] = Owner;
+  Spinlock_Depth[LockId] = 1UL;
+
+#if (SPINLOCK_STATS == 1)
+  /* Updated under the lock: no atomic read-modify-write needed on the M0+ */
+  const uint32 Primask = RP2040_SpinlockStatsBegin(LockId);
+
+  Spinlock_Stats[LockId].u32Acquisitions++;
+  Spinlock_Stats[LockId].u32ContendedSpins += Spins;
+  Spinlock_HoldStart[LockId] = RP2040_SpinlockGetTimeUs();
+
+  RP2040_SpinlockStatsEnd(LockId, Primask);
+#else
+  (void)Spins;
+#endif
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockAcquire function
+///
+/// \param  LockId    : hardware spinlock 0..31
+///         boMaskIrq : TRUE to mask the interrupts of the calling core while holding the lock
+///
+/// \return token to pass to RP2040_SpinlockRelease
+///
+/// \note   Nests on the core holding the lock: only the outermost release frees it.
+///         A lock taken without masking must not be taken by an interrupt handler as well:
+///         on the holding core the handler would nest into the interrupted critical section.
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_SpinlockAcquire(uint32 LockId, boolean boMaskIrq)
+{
+  const uint32 Owner = SPINLOCK_OWNER(SIO->CPUID);
+  const uint32 Token = RP2040_SpinlockMask(boMaskIrq);
+  uint32 Spins = 0UL;
+
+  if(LockId >= SPINLOCK_NB_OF_LOCKS)
+  {
+    return(Token);
+  }
+
+  if(Spinlock_Owner[LockId] == Owner)
+  {
+    Spinlock_Depth[LockId]++;
+    return(Token);
+  }
+
+  while(SPINLOCK_REG(LockId) == 0UL)
+  {
+    Spins++;
+  }
+
+  RP2040_SpinlockTaken(LockId, Owner, Spins);
+
+  return(Token);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockTryAcquire function
+///
+/// \param  LockId    : hardware spinlock 0..31
+///         boMaskIrq : TRUE to mask the interrupts of the calling core while holding the lock
+///         pToken    : token to pass to RP2040_SpinlockRelease (valid when TRUE is returned)
+///
+/// \return TRUE if the lock is held by the calling core, FALSE if it is held by the other one
+//-----------------------------------------------------------------------------------------
+boolean RP2040_SpinlockTryAcquire(uint32 LockId, boolean boMaskIrq, uint32* pToken)
+{
+  const uint32 Owner = SPINLOCK_OWNER(SIO->CPUID);
+  uint32 Token;
+
+  if((LockId >= SPINLOCK_NB_OF_LOCKS) || (pToken == NULL_PTR))
+  {
+    return(FALSE);
+  }
+
+  Token = RP2040_SpinlockMask(boMaskIrq);
+
+  if(Spinlock_Owner[LockId] == Owner)
+  {
+    Spinlock_Depth[LockId]++;
+  }
+  else if(SPINLOCK_REG(LockId) != 0UL)
+  {
+    RP2040_SpinlockTaken(LockId, Owner, 0UL);
+  }
+  else
+  {
+    __set_PRIMASK(Token & SPINLOCK_TOKEN_PRIMASK);
+    return(FALSE);
+  }
+
+  *pToken = Token;
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockRelease function
+///
+/// \param  LockId : hardware spinlock 0..31 held by the calling core
+///         Token  : value returned by the matching acquisition
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_SpinlockRelease(uint32 LockId, uint32 Token)
+{
+  if((LockId < SPINLOCK_NB_OF_LOCKS) && (Spinlock_Owner[LockId] == SPINLOCK_OWNER(SIO->CPUID)))
+  {
+    Spinlock_Depth[LockId]--;
+
+    if(Spinlock_Depth[LockId] == 0UL)
+    {
+#if (SPINLOCK_STATS == 1)
+      const uint32 HoldUs = RP2040_SpinlockGetTimeUs() - Spinlock_HoldStart[LockId];
+
+      if(HoldUs > Spinlock_Stats[LockId].u32MaxHoldUs)
+      {
+        const uint32 Primask = RP2040_SpinlockStatsBegin(LockId);
+
+        Spinlock_Stats[LockId].u32MaxHoldUs = HoldUs;
+
+        RP2040_SpinlockStatsEnd(LockId, Primask);
+      }
+#endif
+
+      Spinlock_Owner[LockId] = SPINLOCK_NO_OWNER;
+
+      __asm volatile("DMB" ::: "memory");
+      SPINLOCK_REG(LockId) = 1UL;
+    }
+  }
+
+  if((Token & SPINLOCK_TOKEN_MASKED) != 0UL)
+  {
+    __set_PRIMASK(Token & SPINLOCK_TOKEN_PRIMASK);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockGetStats function
+///
+/// \param  LockId : hardware spinlock 0..31
+///         pStats : copy of the lock statistics
+///
+/// \return TRUE if the statistics are available (SPINLOCK_STATS build)
+///
+/// \note   Lock-free snapshot (sequence count): reading does not take the lock it reports on.
+//-----------------------------------------------------------------------------------------
+boolean RP2040_SpinlockGetStats(uint32 LockId, Spinlock_StatsType* pStats)
+{
+#if (SPINLOCK_STATS == 1)
+  uint32 Seq;
+
+  if((LockId >= SPINLOCK_NB_OF_LOCKS) || (pStats == NULL_PTR))
+  {
+    return(FALSE);
+  }
+
+  /* Copy again if the holder updated the record meanwhile */
+  do
+  {
+    do
+    {
+      Seq = Spinlock_StatsSeq[LockId];
+    } while((Seq & 1UL) != 0UL);
+
+    __asm volatile("DMB" ::: "memory");
+    *pStats = Spinlock_Stats[LockId];
+    __asm volatile("DMB" ::: "memory");
+  } while(Spinlock_StatsSeq[LockId] != Seq);
+
+  return(TRUE);
+#else
+  (void)LockId;
+  (void)pStats;
+
+  return(FALSE);
+#endif
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockResetStats function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_SpinlockResetStats(void)
+{
+#if (SPINLOCK_STATS == 1)
+  for(uint32 LockId = 0UL; LockId < SPINLOCK_NB_OF_LOCKS; LockId++)
+  {
+    /* Under the lock: the holder on the other core must not update the record meanwhile */
+    const uint32 Token   = RP2040_SpinlockAcquire(LockId, TRUE);
+    const uint32 Primask = RP2040_SpinlockStatsBegin(LockId);
+
+    Spinlock_Stats[LockId].u32Acquisitions   = 0UL;
+    Spinlock_Stats[LockId].u32ContendedSpins = 0UL;
+    Spinlock_Stats[LockId].u32MaxHoldUs      = 0UL;
+
+    RP2040_SpinlockStatsEnd(LockId, Primask);
+    RP2040_SpinlockRelease(LockId, Token);
+  }
+#endif
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockReleaseCore function
+///
+/// \param  CpuId : core whose locks are released
+///
+/// \return void
+///
+/// \note   Recovery after a core has been reset while holding locks: call it from the
+///         other core, only once the reset core no longer runs code that takes them.
+//-----------------------------------------------------------------------------------------
+void RP2040_SpinlockReleaseCore(uint32 CpuId)
+{
+  for(uint32 LockId = 0UL; LockId < SPINLOCK_NB_OF_LOCKS; LockId++)
+  {
+    if(Spinlock_Owner[LockId] == SPINLOCK_OWNER(CpuId))
+    {
+      Spinlock_Depth[LockId] = 0UL;
+      Spinlock_Owner[LockId] = SPINLOCK_NO_OWNER;
+
+      __asm volatile("DMB" ::: "memory");
+      SPINLOCK_REG(LockId) = 1UL;
+    }
+  }
+}
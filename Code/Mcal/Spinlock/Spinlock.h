@@ -0,0 +1,66 @@
+/******************************************************************************************
+  Filename    : Spinlock.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : SIO hardware spinlock API header file
+  
+******************************************************************************************/
+#ifndef __RP2040_SPINLOCK_H__
+#define __RP2040_SPINLOCK_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Configuration
+//=============================================================================
+/* 1: per-lock acquisition count, contended spins and maximum hold time (TIMER, us) */
+#ifndef SPINLOCK_STATS
+  #define SPINLOCK_STATS           0
+#endif
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define SPINLOCK_NB_OF_LOCKS       32UL
+
+/* Locks owned by the drivers, the application uses SPINLOCK_ID_USER_FIRST..SPINLOCK_ID_USER_LAST */
+#define SPINLOCK_ID_USER_FIRST     0UL
+#define SPINLOCK_ID_USER_LAST      28UL
+#define SPINLOCK_ID_STARTUP        29UL
+#define SPINLOCK_ID_BARRIER        30UL
+#define SPINLOCK_ID_CLOCK          31UL
+
+//=============================================================================
+// Types definition
+//=============================================================================
+typedef struct
+{
+  uint32 u32Acquisitions;   /* outermost acquisitions                          */
+  uint32 u32ContendedSpins; /* failed claims while the other core held the lock */
+  uint32 u32MaxHoldUs;      /* longest outermost hold                          */
+}Spinlock_StatsType;
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+uint32 RP2040_SpinlockAcquire(uint32 LockId, boolean boMaskIrq);
+boolean RP2040_SpinlockTryAcquire(uint32 LockId, boolean boMaskIrq, uint32* pToken);
+void RP2040_SpinlockRelease(uint32 LockId, uint32 Token);
+boolean RP2040_SpinlockGetStats(uint32 LockId, Spinlock_StatsType* pStats);
+void RP2040_SpinlockResetStats(void);
+void RP2040_SpinlockReleaseCore(uint32 CpuId);
+
+#endif /*__RP2040_SPINLOCK_H__*/
@@ -17,6 +17,23 @@
 
 #include "SysTickTimer.h"
 
+//=========================================================================================
+// Prototypes
+//=========================================================================================
+static void SysTickTimer_ClockChanged(uint32 u32SysFreqHz);
+
+//=========================================================================================
+// Globals
+//=========================================================================================
+static volatile uint32 SysTickTimer_u32CpuFreqMhz = CLOCK_SYS_FREQ_MHZ;
+static boolean SysTickTimer_boNotifierRegistered;
+
+/* SysTick of each core (private to the core): reload given to SysTickTimer_Start, clk_sys
+   it was computed for, and clk_sys the programmed reload is currently scaled for */
+static volatile uint32 SysTickTimer_u32Load[SYS_TICK_NB_OF_CORES];
+static volatile uint32 SysTickTimer_u32LoadFreqMhz[SYS_TICK_NB_OF_CORES];
+static volatile uint32 SysTickTimer_u32ScaledFreqMhz[SYS_TICK_NB_OF_CORES];
+
 //=========================================================================================
 // Functions
 //=========================================================================================
@@ -36,6 +53,12 @@ void SysTickTimer_Init(void)
   pSTK_VAL->u32Register      = 0;
   pSTK_CTRL->bits.u1CLOCKSRC = SYS_TICK_CLKSRC_PROCESSOR_CLOCK;
   pSTK_CTRL->bits.u1TICKINT  = SYS_TICK_ENABLE_INT;
+
+  /* Follow the clk_sys changes (the notifier is called once with the current frequency) */
+  if(SysTickTimer_boNotifierRegistered == FALSE)
+  {
+    SysTickTimer_boNotifierRegistered = RP2040_ClockRegisterNotifier(&SysTickTimer_ClockChanged);
+  }
 }
 
 //-----------------------------------------------------------------------------
@@ -49,6 +72,13 @@ void SysTickTimer_Init(void)
 //-----------------------------------------------------------------------------
 void SysTickTimer_Start(uint32 timeout)
 {
+  const uint32 CpuId   = SIO->CPUID;
+  const uint32 FreqMhz = SysTickTimer_u32CpuFreqMhz;
+
+  SysTickTimer_u32Load[CpuId]          = timeout;
+  SysTickTimer_u32LoadFreqMhz[CpuId]   = FreqMhz;
+  SysTickTimer_u32ScaledFreqMhz[CpuId] = FreqMhz;
+
   pSTK_LOAD->u32Register   = timeout;
   pSTK_CTRL->bits.u1ENABLE = SYS_TICK_ENABLE_TIMER;
 }
@@ -65,4 +95,91 @@ void SysTickTimer_Start(uint32 timeout)
 void SysTickTimer_Stop(void)
 {
   pSTK_CTRL->bits.u1ENABLE = 0U;
-}
\ No newline at end of file
+}
+
+//-----------------------------------------------------------------------------
+/// \brief
+///
+/// \descr  Current clk_sys frequency in MHz (SysTick clock)
+///
+/// \param  void
+///
+/// \return frequency in MHz
+//-----------------------------------------------------------------------------
+uint32 SysTickTimer_GetCpuFreqMhz(void)
+{
+  return(SysTickTimer_u32CpuFreqMhz);
+}
+
+//-----------------------------------------------------------------------------
+/// \brief
+///
+/// \descr  Keeps the period of the SysTick of the calling core: its reload is
+///         rescaled if clk_sys changed since it was programmed
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   SysTick is private to each core: a clk_sys change rescales the SysTick
+///         of the core that made it, the other core must call this function at
+///         the start of its SysTick handler (its next tick uses the new reload).
+//-----------------------------------------------------------------------------
+void SysTickTimer_Sync(void)
+{
+  const uint32 CpuId   = SIO->CPUID;
+  const uint32 FreqMhz = SysTickTimer_u32CpuFreqMhz;
+  const uint32 Primask = __get_PRIMASK();
+  uint64 Reload;
+
+  if((pSTK_CTRL->bits.u1ENABLE != SYS_TICK_ENABLE_TIMER) || (FreqMhz == SysTickTimer_u32ScaledFreqMhz[CpuId]))
+  {
+    return;
+  }
+
+  /* Not preempted by the SysTick handler of this core (which may sync too) */
+  __asm volatile("CPSID i" ::: "memory");
+
+  if(FreqMhz == SysTickTimer_u32ScaledFreqMhz[CpuId])
+  {
+    __set_PRIMASK(Primask);
+    return;
+  }
+
+  /* From the reload given to SysTickTimer_Start: no rounding error builds up */
+  Reload = (((uint64)SysTickTimer_u32Load[CpuId] + 1ULL) * FreqMhz) / SysTickTimer_u32LoadFreqMhz[CpuId];
+
+  Reload = (Reload > 0x01000000ULL) ? 0x00FFFFFFULL : ((Reload == 0ULL) ? 0ULL : (Reload - 1ULL));
+
+  /* Restart the current period with the new reload */
+  pSTK_LOAD->u32Register = (uint32)Reload;
+  pSTK_VAL->u32Register  = 0UL;
+
+  SysTickTimer_u32ScaledFreqMhz[CpuId] = FreqMhz;
+
+  __set_PRIMASK(Primask);
+}
+
+//-----------------------------------------------------------------------------
+/// \brief
+///
+/// \descr  Clock-change notifier: records the new clk_sys frequency and rescales
+///         the SysTick of the calling core (see SysTickTimer_Sync for the other one)
+///
+/// \param  u32SysFreqHz : new clk_sys frequency (Hz)
+///
+/// \return void
+//-----------------------------------------------------------------------------
+static void SysTickTimer_ClockChanged(uint32 u32SysFreqHz)
+{
+  const uint32 NewFreqMhz = u32SysFreqHz / 1000000UL;
+
+  if(NewFreqMhz == 0UL)
+  {
+    return;
+  }
+
+  SysTickTimer_u32CpuFreqMhz = NewFreqMhz;
+
+  SysTickTimer_Sync();
+}
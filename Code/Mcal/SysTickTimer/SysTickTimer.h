@@ -19,6 +19,7 @@
 #define __SYSTICK_TIMER_H__
 
 #include "Platform_Types.h"
+#include "Clock.h"
 
 //=========================================================================================
 // Types definition
@@ -87,21 +88,26 @@ typedef union
 #define pSTK_VAL    ((volatile stStkVal* const)  (SYS_TICK_BASE_REG + 0x08))
 #define pSTK_CALIB  ((volatile stStkCalib* const)(SYS_TICK_BASE_REG + 0x0C))
 
-#define CPU_FREQ_MHZ      133U
-#define SYS_TICK_MS(x)    ((uint32)(CPU_FREQ_MHZ * x * 1000UL) - 1UL)
-#define SYS_TICK_US(x)    ((uint32)(CPU_FREQ_MHZ * x) - 1UL)
+/* Current clk_sys frequency, kept up to date by the clock-change notifier */
+#define CPU_FREQ_MHZ      SysTickTimer_GetCpuFreqMhz()
+#define SYS_TICK_MS(x)    ((uint32)(CPU_FREQ_MHZ * (x) * 1000UL) - 1UL)
+#define SYS_TICK_US(x)    ((uint32)(CPU_FREQ_MHZ * (x)) - 1UL)
 
 #define SYS_TICK_CLKSRC_PROCESSOR_CLOCK           1U
 #define SYS_TICK_CLKSRC_EXTERNAL_REFERENCE_CLOCK  0U
 #define SYS_TICK_ENABLE_INT                       1U
 #define SYS_TICK_ENABLE_TIMER                     1U
 
+#define SYS_TICK_NB_OF_CORES                      2UL
+
 //=========================================================================================
 // Prototypes
 //=========================================================================================
 void SysTickTimer_Init(void);
 void SysTickTimer_Start(uint32 timeout);
 void SysTickTimer_Stop(void);
+uint32 SysTickTimer_GetCpuFreqMhz(void);
+void SysTickTimer_Sync(void);
 
 
 #endif /*__SYSTICK_TIMER_H__*/
@@ -0,0 +1,89 @@
+/******************************************************************************************
+  Filename    : Timer.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : 64-bit TIMER driver for RP2040
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Timer.h"
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_TimerInit function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_TimerInit(void)
+{
+  /* Start the tick generator (shared with the watchdog) */
+  RP2040_TimerUpdateTick();
+
+  /* Release the reset of the TIMER */
+  RESETS->RESET.bit.timer = 0U;
+  while(RESETS->RESET_DONE.bit.timer != 1U);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_TimerGetTime function
+///
+/// \param  void
+///
+/// \return current value of the 64-bit TIMER counter (ticks)
+//-----------------------------------------------------------------------------------------
+uint64 RP2040_TimerGetTime(void)
+{
+  uint32 High;
+  uint32 Low;
+
+  /* Raw reads are not latched, read again if the high word changed meanwhile */
+  do
+  {
+    High = TIMER->TIMERAWH;
+    Low  = TIMER->TIMERAWL;
+  } while(High != TIMER->TIMERAWH);
+
+  return(((uint64)High << 32) | (uint64)Low);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_TimerUpdateTick function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   Keeps the 1 us tick when clk_ref changes its source (ROSC or XOSC) or divider.
+//-----------------------------------------------------------------------------------------
+void RP2040_TimerUpdateTick(void)
+{
+  const uint32 Cycles = (CLOCKS->CLK_REF_SELECTED == (1UL << CLOCKS_CLK_REF_CTRL_SRC_xosc_clksrc)) ? TIMER_TICK_CYCLES
+                                                                                                  : (RP2040_ClockGetFreq(CLOCK_ID_REF) / 1000000UL);
+
+  WATCHDOG->TICK.reg = (Cycles << WATCHDOG_TICK_CYCLES_Pos) | WATCHDOG_TICK_ENABLE_Msk;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_TimerGetTickCycles function
+///
+/// \param  void
+///
+/// \return number of clk_ref cycles per TIMER tick
+//-----------------------------------------------------------------------------------------
+uint32 RP2040_TimerGetTickCycles(void)
+{
+  return((WATCHDOG->TICK.reg & WATCHDOG_TICK_CYCLES_Msk) >> WATCHDOG_TICK_CYCLES_Pos);
+}
@@ -0,0 +1,46 @@
+/******************************************************************************************
+  Filename    : Timer.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : 64-bit TIMER driver header file for RP2040
+  
+******************************************************************************************/
+#ifndef __RP2040_TIMER_H__
+#define __RP2040_TIMER_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+#include "Clock.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* Number of clk_ref cycles per TIMER tick (clk_ref in MHz gives a 1 us tick).
+   clk_ref runs from the ROSC (nominal frequency from RP2040_ClockGetFreq) until
+   RP2040_ClockInit moves it to the XOSC. */
+#ifndef TIMER_TICK_CYCLES
+  #define TIMER_TICK_CYCLES        (CLOCK_XOSC_FREQ_HZ / 1000000UL)
+#endif
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+void RP2040_TimerInit(void);
+uint64 RP2040_TimerGetTime(void);
+void RP2040_TimerUpdateTick(void);
+uint32 RP2040_TimerGetTickCycles(void);
+
+#endif /*__RP2040_TIMER_H__*/
@@ -0,0 +1,86 @@
+/******************************************************************************************
+  Filename    : Wdg.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Watchdog reset and warm-restart detection for RP2040
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Wdg.h"
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_WdgArmWarmBoot function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_WdgArmWarmBoot(void)
+{
+  /* Let the watchdog reset everything but the clock tree and the voltage regulator */
+  PSM->WDSEL.reg    = WDG_PSM_ALL_BLOCKS    & ~WDG_PSM_WARM_BOOT_KEEP;
+  RESETS->WDSEL.reg = WDG_RESETS_ALL_BLOCKS & ~WDG_RESETS_WARM_BOOT_KEEP;
+
+  /* The watchdog scratch registers survive the watchdog reset */
+  WATCHDOG->SCRATCH0 = WDG_WARM_BOOT_MAGIC;
+  WATCHDOG->SCRATCH1 = ~WDG_WARM_BOOT_MAGIC;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_WdgIsWarmBoot function
+///
+/// \param  void
+///
+/// \return TRUE if the last reset came from the armed watchdog and the clocks survived it
+//-----------------------------------------------------------------------------------------
+boolean RP2040_WdgIsWarmBoot(void)
+{
+  /* Watchdog timeout or forced (software) reset only */
+  if(WATCHDOG->REASON.reg == 0UL)
+  {
+    return(FALSE);
+  }
+
+  if((WATCHDOG->SCRATCH0 != WDG_WARM_BOOT_MAGIC) || (WATCHDOG->SCRATCH1 != ~WDG_WARM_BOOT_MAGIC))
+  {
+    return(FALSE);
+  }
+
+  /* Do not trust the magic alone: check that clk_sys still runs from a locked PLL_SYS */
+  if(   (XOSC->STATUS.bit.STABLE          != 1U)
+     || (RESETS->RESET.bit.pll_sys        != 0U)
+     || (PLL_SYS->CS.bit.LOCK             != 1U)
+     || (CLOCKS->CLK_SYS_CTRL.bit.SRC     != CLOCKS_CLK_SYS_CTRL_SRC_clksrc_clk_sys_aux)
+     || (CLOCKS->CLK_SYS_CTRL.bit.AUXSRC  != CLOCKS_CLK_SYS_CTRL_AUXSRC_clksrc_pll_sys))
+  {
+    return(FALSE);
+  }
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_WdgSoftwareReset function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_WdgSoftwareReset(void)
+{
+  WATCHDOG->CTRL.bit.TRIGGER = 1U;
+
+  for(;;);
+}
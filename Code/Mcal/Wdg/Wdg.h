@@ -0,0 +1,48 @@
+/******************************************************************************************
+  Filename    : Wdg.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Watchdog reset and warm-restart detection header file for RP2040
+  
+******************************************************************************************/
+#ifndef __RP2040_WDG_H__
+#define __RP2040_WDG_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RP2040.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define WDG_WARM_BOOT_MAGIC        0x4D524157UL /* "WARM" */
+
+#define WDG_PSM_ALL_BLOCKS         0x0001FFFFUL
+#define WDG_RESETS_ALL_BLOCKS      0x01FFFFFFUL
+
+/* Blocks kept alive by a watchdog reset in warm-boot mode: oscillators, clock generators,
+   the reset controller (PLLs stay out of reset) and the voltage regulator setting */
+#define WDG_PSM_WARM_BOOT_KEEP     (PSM_WDSEL_rosc_Msk | PSM_WDSEL_xosc_Msk | PSM_WDSEL_clocks_Msk | \
+                                    PSM_WDSEL_resets_Msk | PSM_WDSEL_vreg_and_chip_reset_Msk)
+
+#define WDG_RESETS_WARM_BOOT_KEEP  (RESETS_WDSEL_pll_sys_Msk | RESETS_WDSEL_pll_usb_Msk)
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+void RP2040_WdgArmWarmBoot(void);
+boolean RP2040_WdgIsWarmBoot(void);
+void RP2040_WdgSoftwareReset(void);
+
+#endif /*__RP2040_WDG_H__*/
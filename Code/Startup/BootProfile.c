@@ -0,0 +1,79 @@
+/******************************************************************************************
+  Filename    : BootProfile.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Boot phase timestamp recorder (TIMER based, kept in .noinit RAM)
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "BootProfile.h"
+#include "Timer.h"
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+#if (STARTUP_BOOT_PROFILE == 1)
+/* Located in .noinit: written before the RAM initialization and never cleared */
+volatile BootProfile_Type BootProfile_Record NOINIT_DATA;
+#endif
+
+//-----------------------------------------------------------------------------------------
+/// \brief  BootProfile_Init function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   On a cold boot clk_ref still runs from the ROSC: see BOOT_PROFILE_FLAG_ROSC_TICK.
+//-----------------------------------------------------------------------------------------
+void BootProfile_Init(void)
+{
+#if (STARTUP_BOOT_PROFILE == 1)
+  RP2040_TimerInit();
+
+  BootProfile_Record.u32Magic       = 0UL;
+  BootProfile_Record.u32TickCycles  = RP2040_TimerGetTickCycles();
+  BootProfile_Record.u32StampedMask = 0UL;
+  BootProfile_Record.u32Flags       = (CLOCKS->CLK_REF_SELECTED != (1UL << CLOCKS_CLK_REF_CTRL_SRC_xosc_clksrc)) ? BOOT_PROFILE_FLAG_ROSC_TICK : 0UL;
+
+  BootProfile_Stamp(BOOT_PHASE_ENTRY);
+
+  BootProfile_Record.u32Magic = BOOT_PROFILE_MAGIC;
+#endif
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  BootProfile_Stamp function
+///
+/// \param  Phase : boot phase that just ended (BOOT_PHASE_xxx)
+///
+/// \return void
+///
+/// \note   No-op without STARTUP_BOOT_PROFILE: the .noinit record is never initialized
+///         then, a stamp would turn leftover RAM into a record that looks valid.
+//-----------------------------------------------------------------------------------------
+void BootProfile_Stamp(uint32 Phase)
+{
+#if (STARTUP_BOOT_PROFILE == 1)
+  if(Phase < BOOT_PROFILE_NB_OF_PHASES)
+  {
+    BootProfile_Record.u64Stamp[Phase] = RP2040_TimerGetTime();
+    BootProfile_Record.u32StampedMask |= (1UL << Phase);
+  }
+#else
+  (void)Phase;
+#endif
+}
@@ -0,0 +1,74 @@
+/******************************************************************************************
+  Filename    : BootProfile.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Boot phase timestamp recorder header file
+  
+******************************************************************************************/
+#ifndef __BOOT_PROFILE_H__
+#define __BOOT_PROFILE_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Configuration
+//=============================================================================
+/* 1: the end of each boot phase is stamped into BootProfile_Record (.noinit),
+   0: BootProfile_Init/BootProfile_Stamp do nothing and the record is not linked */
+#ifndef STARTUP_BOOT_PROFILE
+  #define STARTUP_BOOT_PROFILE  0
+#endif
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define BOOT_PROFILE_MAGIC           0x544F4F42UL /* "BOOT" */
+
+/* u32Flags: clk_ref ran on the ROSC when the profile started. The TIMER tick is then
+   derived from the nominal ROSC frequency, which varies widely across parts, voltage
+   and temperature: the stamps up to BOOT_PHASE_CLOCK (the XOSC takes over clk_ref) are
+   not us-accurate and are only comparable build over build on the same board */
+#define BOOT_PROFILE_FLAG_ROSC_TICK  0x00000001UL
+
+/* Boot phases, each stamp is taken at the end of the phase */
+#define BOOT_PHASE_ENTRY             0UL  /* Startup_Init entered             */
+#define BOOT_PHASE_CORE              1UL  /* Startup_InitCore done            */
+#define BOOT_PHASE_CLOCK             2UL  /* Startup_InitSystemClock done     */
+#define BOOT_PHASE_RAM               3UL  /* Startup_InitRam done             */
+#define BOOT_PHASE_CTORS             4UL  /* Startup_InitCtors done           */
+#define BOOT_PHASE_CORE1_START       5UL  /* RP2040_StartCore1 handshake done */
+#define BOOT_PROFILE_NB_OF_PHASES    6UL
+
+//=============================================================================
+// Types definition
+//=============================================================================
+
+/* Layout shared with Tools/BootProfile.py */
+typedef struct
+{
+  uint32 u32Magic;
+  uint32 u32TickCycles;
+  uint32 u32StampedMask;
+  uint32 u32Flags;
+  uint64 u64Stamp[BOOT_PROFILE_NB_OF_PHASES];
+}BootProfile_Type;
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+void BootProfile_Init(void);
+void BootProfile_Stamp(uint32 Phase);
+
+#endif /*__BOOT_PROFILE_H__*/
@@ -0,0 +1,112 @@
+/******************************************************************************************
+  Filename    : NoInit.c
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Integrity header for data retained in .noinit RAM across resets
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "NoInit.h"
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* CRC-32 (IEEE 802.3, reflected, polynomial 0xEDB88320) nibble table */
+static const uint32 NoInit_Crc32Table[16] =
+{
+  0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+  0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+  0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+  0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+//-----------------------------------------------------------------------------------------
+/// \brief  NoInit_IsValid function
+///
+/// \param  pHeader : integrity header of the retained block
+///         pData   : retained data
+///         Size    : size of the retained data in bytes
+///
+/// \return TRUE if the retained data has been sealed and is intact, FALSE otherwise
+//-----------------------------------------------------------------------------------------
+boolean NoInit_IsValid(const volatile NoInit_HeaderType* pHeader, const volatile void* pData, uint32 Size)
+{
+  /* Cheap checks first: garbage after a power-on almost never passes them */
+  if(   (pHeader->u32Magic != NOINIT_MAGIC)
+     || (pHeader->u32Size  != Size)
+     || (pHeader->u32Inv   != ~(pHeader->u32Magic ^ pHeader->u32Size ^ pHeader->u32Crc)))
+  {
+    return(FALSE);
+  }
+
+  return((pHeader->u32Crc == NoInit_Crc32(pData, Size)) ? TRUE : FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  NoInit_Seal function
+///
+/// \param  pHeader : integrity header of the retained block
+///         pData   : retained data
+///         Size    : size of the retained data in bytes
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void NoInit_Seal(volatile NoInit_HeaderType* pHeader, const volatile void* pData, uint32 Size)
+{
+  const uint32 Crc = NoInit_Crc32(pData, Size);
+
+  pHeader->u32Magic = NOINIT_MAGIC;
+  pHeader->u32Size  = Size;
+  pHeader->u32Crc   = Crc;
+  pHeader->u32Inv   = ~(NOINIT_MAGIC ^ Size ^ Crc);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  NoInit_Invalidate function
+///
+/// \param  pHeader : integrity header of the retained block
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void NoInit_Invalidate(volatile NoInit_HeaderType* pHeader)
+{
+  pHeader->u32Magic = 0UL;
+  pHeader->u32Inv   = 0UL;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  NoInit_Crc32 function
+///
+/// \param  pData : data block
+///         Size  : size of the data block in bytes
+///
+/// \return CRC-32 of the data block
+//-----------------------------------------------------------------------------------------
+uint32 NoInit_Crc32(const volatile void* pData, uint32 Size)
+{
+  const volatile uint8* pByte = (const volatile uint8*)pData;
+  uint32 Crc = 0xFFFFFFFFUL;
+
+  while(Size != 0UL)
+  {
+    Crc ^= (uint32)*pByte++;
+    Crc  = (Crc >> 4) ^ NoInit_Crc32Table[Crc & 0x0FUL];
+    Crc  = (Crc >> 4) ^ NoInit_Crc32Table[Crc & 0x0FUL];
+    Size--;
+  }
+
+  return(~Crc);
+}
@@ -0,0 +1,49 @@
+/******************************************************************************************
+  Filename    : NoInit.h
+  
+  Core        : ARM Cortex-M0+
+  
+  MCU         : RP2040
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Integrity header for data retained in .noinit RAM across resets
+  
+******************************************************************************************/
+#ifndef __NOINIT_H__
+#define __NOINIT_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define NOINIT_MAGIC    0x54494E49UL /* "INIT" */
+
+//=============================================================================
+// Types definition
+//=============================================================================
+typedef struct
+{
+  uint32 u32Magic;  /* NOINIT_MAGIC when the block has been sealed       */
+  uint32 u32Size;   /* size of the protected data (detects layout change) */
+  uint32 u32Crc;    /* CRC-32 of the protected data                       */
+  uint32 u32Inv;    /* ~(u32Magic ^ u32Size ^ u32Crc)                     */
+}NoInit_HeaderType;
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+boolean NoInit_IsValid(const volatile NoInit_HeaderType* pHeader, const volatile void* pData, uint32 Size);
+void NoInit_Seal(volatile NoInit_HeaderType* pHeader, const volatile void* pData, uint32 Size);
+void NoInit_Invalidate(volatile NoInit_HeaderType* pHeader);
+uint32 NoInit_Crc32(const volatile void* pData, uint32 Size);
+
+#endif /*__NOINIT_H__*/
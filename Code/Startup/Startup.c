@@ -11,6 +11,13 @@
 // 
 // ***************************************************************************************
 
+//=========================================================================================
+// includes
+//=========================================================================================
+#include "Platform_Types.h"
+#include "BootProfile.h"
+#include "Startup.h"
+
 //=========================================================================================
 // types definitions
 //=========================================================================================
@@ -31,32 +38,144 @@ typedef struct
 // linker variables
 //=========================================================================================
 extern const runtimeCopyTable_t __RUNTIME_COPY_TABLE[];
+extern const runtimeCopyTable_t __RUNTIME_LZ_COPY_TABLE[];
 extern const runtimeClearTable_t __RUNTIME_CLEAR_TABLE[];
+extern const runtimeClearTable_t __RUNTIME_COLD_CLEAR_TABLE[];
 extern unsigned long __CPPCTOR_LIST__[];
+extern unsigned long __CPPCTOR_DEFERRED_LIST__[];
+extern unsigned long __CPPCTOR_CORE1_LIST__[];
 
 //=========================================================================================
 // defines
 //=========================================================================================
 #define __STARTUP_RUNTIME_COPYTABLE   (runtimeCopyTable_t*)(&__RUNTIME_COPY_TABLE[0])
+#define __STARTUP_RUNTIME_LZCOPYTABLE (runtimeCopyTable_t*)(&__RUNTIME_LZ_COPY_TABLE[0])
 #define __STARTUP_RUNTIME_CLEARTABLE  (runtimeClearTable_t*)(&__RUNTIME_CLEAR_TABLE[0])
+#define __STARTUP_RUNTIME_COLD_CLEARTABLE  (runtimeClearTable_t*)(&__RUNTIME_COLD_CLEAR_TABLE[0])
 #define __STARTUP_RUNTIME_CTORS       (unsigned long*)(&__CPPCTOR_LIST__[0])
+#define __STARTUP_RUNTIME_DEFERRED_CTORS  (unsigned long*)(&__CPPCTOR_DEFERRED_LIST__[0])
+#define __STARTUP_RUNTIME_CORE1_CTORS     (unsigned long*)(&__CPPCTOR_CORE1_LIST__[0])
+
+/* Share of each clear/copy table entry initialized by the calling core */
+#define STARTUP_RAM_PART_ALL          0UL
+#define STARTUP_RAM_PART_LOWER        1UL
+#define STARTUP_RAM_PART_UPPER        2UL
+
+#define STARTUP_RAM_PART_DONE         0x52414D31UL /* "RAM1" */
+
+/* State of a constructor tier run on demand (RUNNING + CPUID: 1 on core 0, 2 on core 1) */
+#define STARTUP_CTORS_IDLE            0UL
+#define STARTUP_CTORS_RUNNING         1UL
+#define STARTUP_CTORS_DONE            3UL
+
+/* Hardware spinlock guarding the tier states (SPINLOCK_ID_STARTUP in Spinlock.h) */
+#define STARTUP_CTORS_SPINLOCK        29UL
+
+/* SIO CPUID register (the crt0 does not include RP2040.h) */
+#define STARTUP_SIO_CPUID             (*(volatile const unsigned long*)0xD0000000UL)
+
+//=========================================================================================
+// configuration
+//=========================================================================================
+/* 1: .data/.bss word bodies are transferred by DMA while the core and clocks are set up */
+#ifndef STARTUP_RAM_INIT_DMA
+  #define STARTUP_RAM_INIT_DMA  0
+#endif
+
+/* 1: core 1 is launched early and initializes the upper half of each .data/.bss block */
+#ifndef STARTUP_RAM_INIT_DUAL_CORE
+  #define STARTUP_RAM_INIT_DUAL_CORE  0
+#endif
+
+/* 1: after an armed watchdog reset, the clock/PLL bring-up, the core 1 power cycle and the
+      cold-only RAM (.bss_retained) are skipped */
+#ifndef STARTUP_WARM_BOOT
+  #define STARTUP_WARM_BOOT  0
+#endif
+
+/* STARTUP_BOOT_PROFILE (boot phase stamps) is configured in BootProfile.h */
+
+/* 1: on a cold boot, the RAM is initialized on the ROSC while the XOSC starts up
+      and the PLLs lock */
+#ifndef STARTUP_CLOCK_OVERLAP
+  #define STARTUP_CLOCK_OVERLAP  0
+#endif
+
+/* 1: fast boot, the startup runs on the boosted ROSC and the application completes the
+      switch to PLL_SYS (RP2040_ClockPollDeferred/RP2040_ClockCompleteDeferred) */
+#ifndef STARTUP_CLOCK_DEFERRED
+  #define STARTUP_CLOCK_DEFERRED  0
+#endif
+
+#if (STARTUP_RAM_INIT_DMA == 1) && (STARTUP_RAM_INIT_DUAL_CORE == 1)
+  #error "STARTUP_RAM_INIT_DMA and STARTUP_RAM_INIT_DUAL_CORE are mutually exclusive"
+#endif
+
+#if (STARTUP_CLOCK_OVERLAP == 1) && ((STARTUP_RAM_INIT_DMA == 1) || (STARTUP_RAM_INIT_DUAL_CORE == 1))
+  #error "STARTUP_CLOCK_OVERLAP is exclusive with STARTUP_RAM_INIT_DMA and STARTUP_RAM_INIT_DUAL_CORE"
+#endif
+
+#if (STARTUP_CLOCK_DEFERRED == 1) && ((STARTUP_CLOCK_OVERLAP == 1) || (STARTUP_WARM_BOOT == 1))
+  #error "STARTUP_CLOCK_DEFERRED is exclusive with STARTUP_CLOCK_OVERLAP and STARTUP_WARM_BOOT"
+#endif
 
 //=========================================================================================
 // function prototype
 //=========================================================================================
 void Startup_Init(void) __attribute__((used));
-static void Startup_InitRam(void);
+static void Startup_InitRam(unsigned long Part);
+static void Startup_InitColdRam(void);
+static void Startup_SplitBlock(unsigned long Part, unsigned long* pOffset, unsigned long* pSize);
 static void Startup_InitCtors(void);
+static void Startup_RunCtorList(const unsigned long* pCtorList);
+static void Startup_RunCtorTier(const unsigned long* pCtorList, volatile unsigned long* pState);
 static void Startup_RunApplication(void);
 static void Startup_Unexpected_Exit(void);
 static void Startup_InitSystemClock(void);
 static void Startup_InitCore(void);
+static void Startup_MemCopy(unsigned long targetAddr, unsigned long sourceAddr, unsigned long size);
+static void Startup_MemClear(unsigned long targetAddr, unsigned long size);
+static void Startup_LzCopy(unsigned long targetAddr, unsigned long sourceAddr, unsigned long size);
+#if (STARTUP_RAM_INIT_DUAL_CORE == 1)
+static void Startup_InitRamDualCore(void);
+static void Startup_InitRamCore1(void);
+#endif
 //=========================================================================================
 // extern function prototype
 //=========================================================================================
 int main(void) __attribute__((weak));
 void RP2040_ClockInit(void) __attribute__((weak));
+#if (STARTUP_CLOCK_OVERLAP == 1)
+void RP2040_ClockStartXosc(void);
+void RP2040_ClockStartPlls(void);
+void RP2040_ClockFinishInit(void);
+#endif
+#if (STARTUP_CLOCK_DEFERRED == 1)
+void RP2040_ClockRoscBoost(void);
+void RP2040_ClockStartXosc(void);
+#endif
 void RP2040_InitCore(void) __attribute__((weak));
+uint32 RP2040_SpinlockAcquire(uint32 LockId, boolean boMaskIrq);
+void RP2040_SpinlockRelease(uint32 LockId, uint32 Token);
+void Startup_CopyWords(unsigned long* pTarget, const unsigned long* pSource, unsigned long words);
+void Startup_ClearWords(unsigned long* pTarget, unsigned long words);
+#if (STARTUP_RAM_INIT_DMA == 1)
+void RP2040_DmaInit(void);
+unsigned long RP2040_DmaMemCopy(unsigned long targetAddr, unsigned long sourceAddr, unsigned long words);
+unsigned long RP2040_DmaMemClear(unsigned long targetAddr, unsigned long words);
+void RP2040_DmaWaitMemTransfers(void);
+#endif
+#if (STARTUP_WARM_BOOT == 1)
+boolean RP2040_WdgIsWarmBoot(void);
+void RP2040_WdgArmWarmBoot(void);
+void RP2040_InitIoBanks(void);
+#endif
+#if (STARTUP_RAM_INIT_DUAL_CORE == 1)
+boolean RP2040_StartCore1Entry(pFunc Entry);
+void RP2040_ResetCore1(void);
+void RP2040_FifoPush(uint32 Data);
+uint32 RP2040_FifoPop(void);
+#endif
 
 //=========================================================================================
 // macros
@@ -64,6 +183,12 @@ void RP2040_InitCore(void) __attribute__((weak));
 #define ENABLE_IRQ()  __asm("CPSIE i")
 #define DISABLE_IRQ() __asm("CPSID i")
 
+#if (STARTUP_BOOT_PROFILE == 1)
+  #define STARTUP_BOOT_STAMP(phase)  BootProfile_Stamp(phase)
+#else
+  #define STARTUP_BOOT_STAMP(phase)
+#endif
+
 //-----------------------------------------------------------------------------------------
 /// \brief  Startup_Init function
 ///
@@ -73,17 +198,96 @@ void RP2040_InitCore(void) __attribute__((weak));
 //-----------------------------------------------------------------------------------------
 void Startup_Init(void)
 {
-  /* Initialize the CPU Core */
-  Startup_InitCore();
+#if (STARTUP_BOOT_PROFILE == 1)
+  /* Start the boot profile (stamps BOOT_PHASE_ENTRY) */
+  BootProfile_Init();
+#endif
+
+#if (STARTUP_WARM_BOOT == 1)
+  /* Detect a warm restart (the clock tree survived an armed watchdog reset) */
+  const boolean boWarmBoot = RP2040_WdgIsWarmBoot();
+#else
+  const boolean boWarmBoot = FALSE;
+#endif
+
+#if (STARTUP_RAM_INIT_DMA == 1)
+  /* Start the RAM initialization in the background (DMA) */
+  RP2040_DmaInit();
+  Startup_InitRam(STARTUP_RAM_PART_ALL);
 
-  /* Configure the system clock */
-  Startup_InitSystemClock();
+  if(boWarmBoot == FALSE)
+  {
+    Startup_InitColdRam();
+  }
+#endif
+
+  if(boWarmBoot == FALSE)
+  {
+    /* Initialize the CPU Core */
+    Startup_InitCore();
+    STARTUP_BOOT_STAMP(BOOT_PHASE_CORE);
+
+#if (STARTUP_CLOCK_OVERLAP == 1)
+    /* Initialize the RAM memory while the XOSC starts up and the PLLs lock
+       (the CLOCK phase includes the RAM initialization) */
+    RP2040_ClockStartXosc();
+    Startup_InitRam(STARTUP_RAM_PART_ALL);
+    RP2040_ClockStartPlls();
+    Startup_InitColdRam();
+    RP2040_ClockFinishInit();
+#elif (STARTUP_CLOCK_DEFERRED == 1)
+    /* Run the startup on the boosted ROSC while the XOSC starts up */
+    RP2040_ClockRoscBoost();
+    RP2040_ClockStartXosc();
+#else
+    /* Configure the system clock */
+    Startup_InitSystemClock();
+#endif
+    STARTUP_BOOT_STAMP(BOOT_PHASE_CLOCK);
+
+#if (STARTUP_WARM_BOOT == 1)
+    /* From now on, a watchdog reset restarts through the warm path */
+    RP2040_WdgArmWarmBoot();
+#endif
+  }
+#if (STARTUP_WARM_BOOT == 1)
+  else
+  {
+    /* Core 1 has been reset by the watchdog and clk_sys still runs from PLL_SYS */
+    RP2040_InitIoBanks();
+    STARTUP_BOOT_STAMP(BOOT_PHASE_CORE);
+    STARTUP_BOOT_STAMP(BOOT_PHASE_CLOCK);
+  }
+#endif
 
+#if (STARTUP_RAM_INIT_DMA == 1)
+  /* Wait for the end of the RAM initialization */
+  RP2040_DmaWaitMemTransfers();
+#elif (STARTUP_CLOCK_OVERLAP == 1)
+  /* The RAM memory has been initialized with the clocks on a cold boot */
+  if(boWarmBoot == TRUE)
+  {
+    Startup_InitRam(STARTUP_RAM_PART_ALL);
+  }
+#else
+  #if (STARTUP_RAM_INIT_DUAL_CORE == 1)
+  /* Initialize the RAM memory on both cores */
+  Startup_InitRamDualCore();
+  #else
   /* Initialize the RAM memory */
-  Startup_InitRam();
+  Startup_InitRam(STARTUP_RAM_PART_ALL);
+  #endif
+
+  if(boWarmBoot == FALSE)
+  {
+    Startup_InitColdRam();
+  }
+#endif
+  STARTUP_BOOT_STAMP(BOOT_PHASE_RAM);
 
   /* Initialize the non-local C++ objects */
   Startup_InitCtors();
+  STARTUP_BOOT_STAMP(BOOT_PHASE_CTORS);
 
   /* Start the application */
   Startup_RunApplication();
@@ -93,23 +297,25 @@ void Startup_Init(void)
 //-----------------------------------------------------------------------------------------
 /// \brief  Startup_InitRam function
 ///
-/// \param  void
+/// \param  Part : share of each table entry to initialize (STARTUP_RAM_PART_xxx)
 ///
 /// \return void
 //-----------------------------------------------------------------------------------------
-static void Startup_InitRam(void)
+static void Startup_InitRam(unsigned long Part)
 {
   unsigned long ClearTableIdx = 0;
   unsigned long CopyTableIdx  = 0;
+  unsigned long Offset;
+  unsigned long Size;
 
   /* Clear Table */
 
   while((__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].Addr != (unsigned long)-1 && (__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].size != (unsigned long)-1)
   {
-    for(unsigned int cpt = 0; cpt < (__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].size; cpt++)
-    {
-      *(volatile unsigned char*)((unsigned long)((__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].Addr) + cpt) = 0;
-    }
+    Size = (__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].size;
+    Startup_SplitBlock(Part, &Offset, &Size);
+
+    Startup_MemClear((__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].Addr + Offset, Size);
 
     ClearTableIdx++;
   }
@@ -121,13 +327,275 @@ static void Startup_InitRam(void)
         (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].size       != (unsigned long)-1
        )
   {
-    for(unsigned int cpt = 0; cpt < (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].size; cpt++)
+    Size = (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].size;
+    Startup_SplitBlock(Part, &Offset, &Size);
+
+    Startup_MemCopy((__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].targetAddr + Offset,
+                    (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].sourceAddr + Offset,
+                    Size);
+
+    CopyTableIdx++;
+  }
+
+  /* LZ Copy Table (compressed load images cannot be split, they stay on one core) */
+
+  CopyTableIdx = 0;
+
+  while((Part != STARTUP_RAM_PART_UPPER) &&
+        (__STARTUP_RUNTIME_LZCOPYTABLE)[CopyTableIdx].sourceAddr != (unsigned long)-1 &&
+        (__STARTUP_RUNTIME_LZCOPYTABLE)[CopyTableIdx].targetAddr != (unsigned long)-1 &&
+        (__STARTUP_RUNTIME_LZCOPYTABLE)[CopyTableIdx].size       != (unsigned long)-1
+       )
+  {
+    Startup_LzCopy((__STARTUP_RUNTIME_LZCOPYTABLE)[CopyTableIdx].targetAddr,
+                   (__STARTUP_RUNTIME_LZCOPYTABLE)[CopyTableIdx].sourceAddr,
+                   (__STARTUP_RUNTIME_LZCOPYTABLE)[CopyTableIdx].size);
+
+    CopyTableIdx++;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_InitColdRam function (skipped on a warm restart)
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_InitColdRam(void)
+{
+  unsigned long ClearTableIdx = 0;
+
+  while((__STARTUP_RUNTIME_COLD_CLEARTABLE)[ClearTableIdx].Addr != (unsigned long)-1 && (__STARTUP_RUNTIME_COLD_CLEARTABLE)[ClearTableIdx].size != (unsigned long)-1)
+  {
+    Startup_MemClear((__STARTUP_RUNTIME_COLD_CLEARTABLE)[ClearTableIdx].Addr,
+                     (__STARTUP_RUNTIME_COLD_CLEARTABLE)[ClearTableIdx].size);
+
+    ClearTableIdx++;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_SplitBlock function
+///
+/// \param  Part    : share of the block (STARTUP_RAM_PART_xxx)
+///         pOffset : offset of the share in the block
+///         pSize   : in: size of the block, out: size of the share
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_SplitBlock(unsigned long Part, unsigned long* pOffset, unsigned long* pSize)
+{
+  /* The split point is word-aligned so that both cores keep the word-wide path */
+  const unsigned long Half = (*pSize / 2UL) & ~3UL;
+
+  if(Part == STARTUP_RAM_PART_LOWER)
+  {
+    *pOffset = 0UL;
+    *pSize   = Half;
+  }
+  else if(Part == STARTUP_RAM_PART_UPPER)
+  {
+    *pOffset = Half;
+    *pSize  -= Half;
+  }
+  else
+  {
+    *pOffset = 0UL;
+  }
+}
+
+#if (STARTUP_RAM_INIT_DUAL_CORE == 1)
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_InitRamDualCore function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_InitRamDualCore(void)
+{
+  if(RP2040_StartCore1Entry(&Startup_InitRamCore1) == TRUE)
+  {
+    /* Core 1 handles the upper half of each block */
+    Startup_InitRam(STARTUP_RAM_PART_LOWER);
+
+    /* Join with core 1 */
+    while(RP2040_FifoPop() != STARTUP_RAM_PART_DONE);
+
+    /* Send core 1 back to the BootRom for the application launch */
+    RP2040_ResetCore1();
+  }
+  else
+  {
+    /* Core 1 did not start, do the whole initialization on core 0 */
+    RP2040_ResetCore1();
+    Startup_InitRam(STARTUP_RAM_PART_ALL);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_InitRamCore1 function (executed by core 1)
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_InitRamCore1(void)
+{
+  Startup_InitRam(STARTUP_RAM_PART_UPPER);
+
+  RP2040_FifoPush(STARTUP_RAM_PART_DONE);
+
+  /* Park until core 0 resets this core */
+  for(;;)
+  {
+    __asm volatile("WFE");
+  }
+}
+#endif
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_MemCopy function
+///
+/// \param  targetAddr : destination address in RAM
+///         sourceAddr : source address (load image)
+///         size       : number of bytes to copy
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_MemCopy(unsigned long targetAddr, unsigned long sourceAddr, unsigned long size)
+{
+  /* Word transfers are only possible when both sides share the same word alignment */
+  if(((targetAddr ^ sourceAddr) & 3UL) == 0UL)
+  {
+    /* Byte head up to the first word boundary */
+    while((size != 0UL) && ((targetAddr & 3UL) != 0UL))
     {
-      *(volatile unsigned char*)((unsigned long)((__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].targetAddr) + cpt) = 
-               *(volatile unsigned char*)((unsigned long)((__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].sourceAddr) + cpt);
+      *(volatile unsigned char*)targetAddr++ = *(volatile unsigned char*)sourceAddr++;
+      size--;
     }
 
-    CopyTableIdx++;
+    /* Word body (DMA when available, LDM/STM bursts otherwise) */
+#if (STARTUP_RAM_INIT_DMA == 1)
+    if(RP2040_DmaMemCopy(targetAddr, sourceAddr, size / 4UL) == 0UL)
+#endif
+    {
+      Startup_CopyWords((unsigned long*)targetAddr, (const unsigned long*)sourceAddr, size / 4UL);
+    }
+
+    targetAddr += (size & ~3UL);
+    sourceAddr += (size & ~3UL);
+    size       &= 3UL;
+  }
+
+  /* Byte tail (or the whole block for mismatched alignment) */
+  while(size != 0UL)
+  {
+    *(volatile unsigned char*)targetAddr++ = *(volatile unsigned char*)sourceAddr++;
+    size--;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_MemClear function
+///
+/// \param  targetAddr : address of the RAM block to clear
+///         size       : number of bytes to clear
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_MemClear(unsigned long targetAddr, unsigned long size)
+{
+  /* Byte head up to the first word boundary */
+  while((size != 0UL) && ((targetAddr & 3UL) != 0UL))
+  {
+    *(volatile unsigned char*)targetAddr++ = 0;
+    size--;
+  }
+
+  /* Word body (DMA when available, STM bursts otherwise) */
+#if (STARTUP_RAM_INIT_DMA == 1)
+  if(RP2040_DmaMemClear(targetAddr, size / 4UL) == 0UL)
+#endif
+  {
+    Startup_ClearWords((unsigned long*)targetAddr, size / 4UL);
+  }
+
+  targetAddr += (size & ~3UL);
+  size       &= 3UL;
+
+  /* Byte tail */
+  while(size != 0UL)
+  {
+    *(volatile unsigned char*)targetAddr++ = 0;
+    size--;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_LzCopy function (decoder of Tools/DataLz.py, LZ4 block layout)
+///
+/// \param  targetAddr : destination address in RAM
+///         sourceAddr : compressed load image
+///         size       : number of bytes to produce
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_LzCopy(unsigned long targetAddr, unsigned long sourceAddr, unsigned long size)
+{
+  const volatile unsigned char* pSource = (const volatile unsigned char*)sourceAddr;
+  volatile unsigned char*       pTarget = (volatile unsigned char*)targetAddr;
+  volatile unsigned char* const pEnd    = pTarget + size;
+
+  while(pTarget < pEnd)
+  {
+    const unsigned long Token = *pSource++;
+    unsigned long Length      = Token >> 4;
+    unsigned long Ext;
+
+    /* Literal run */
+    if(Length == 15UL)
+    {
+      do
+      {
+        Ext     = *pSource++;
+        Length += Ext;
+      } while(Ext == 255UL);
+    }
+
+    while(Length-- != 0UL)
+    {
+      *pTarget++ = *pSource++;
+    }
+
+    /* The last sequence has no match */
+    if(pTarget >= pEnd)
+    {
+      break;
+    }
+
+    /* Match: copy from the already decoded output (may overlap) */
+    const unsigned long Offset = (unsigned long)pSource[0] | ((unsigned long)pSource[1] << 8);
+    pSource += 2;
+
+    Length = (Token & 0x0FUL) + 4UL;
+
+    if((Token & 0x0FUL) == 15UL)
+    {
+      do
+      {
+        Ext     = *pSource++;
+        Length += Ext;
+      } while(Ext == 255UL);
+    }
+
+    const volatile unsigned char* pMatch = pTarget - Offset;
+
+    while(Length-- != 0UL)
+    {
+      *pTarget++ = *pMatch++;
+    }
   }
 }
 
@@ -139,12 +607,118 @@ static void Startup_InitRam(void)
 /// \return void
 //-----------------------------------------------------------------------------------------
 static void Startup_InitCtors(void)
+{
+  /* Critical tier only, the deferred and core 1 tiers are run on demand */
+  Startup_RunCtorList(__STARTUP_RUNTIME_CTORS);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief Startup_InitDeferredCtors function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   Runs the deferred constructor tier once. Called by the application after the
+///         cores are up, or by the first user of a deferred object on either core: a caller
+///         that finds the tier running on the other core waits until it is complete.
+//-----------------------------------------------------------------------------------------
+void Startup_InitDeferredCtors(void)
+{
+  static volatile unsigned long State = STARTUP_CTORS_IDLE;
+
+  Startup_RunCtorTier(__STARTUP_RUNTIME_DEFERRED_CTORS, &State);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief Startup_InitCore1Ctors function
+///
+/// \param  void
+///
+/// \return void
+///
+/// \note   Runs the core 1 constructor tier once, must be called on core 1.
+//-----------------------------------------------------------------------------------------
+void Startup_InitCore1Ctors(void)
+{
+  static volatile unsigned long State = STARTUP_CTORS_IDLE;
+
+  Startup_RunCtorTier(__STARTUP_RUNTIME_CORE1_CTORS, &State);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief Startup_RunCtorTier function
+///
+/// \param  pCtorList : constructor table terminated by (unsigned long)-1
+///         pState    : state of the tier (STARTUP_CTORS_xxx)
+///
+/// \return void
+///
+/// \note   The first caller claims the tier under the startup spinlock and runs it, the tier
+///         is marked done only once every constructor has returned. A caller on the other
+///         core waits (WFE) for it, a nested call from a constructor of the tier returns.
+//-----------------------------------------------------------------------------------------
+static void Startup_RunCtorTier(const unsigned long* pCtorList, volatile unsigned long* pState)
+{
+  const unsigned long Running = STARTUP_CTORS_RUNNING + STARTUP_SIO_CPUID;
+  unsigned long State;
+  uint32 Token;
+
+  if(*pState == STARTUP_CTORS_DONE)
+  {
+    return;
+  }
+
+  Token = RP2040_SpinlockAcquire(STARTUP_CTORS_SPINLOCK, TRUE);
+
+  State = *pState;
+
+  if(State == STARTUP_CTORS_IDLE)
+  {
+    *pState = Running;
+  }
+
+  RP2040_SpinlockRelease(STARTUP_CTORS_SPINLOCK, Token);
+
+  if(State == STARTUP_CTORS_IDLE)
+  {
+    Startup_RunCtorList(pCtorList);
+
+    /* Publish the constructed objects before the state, then wake the waiting core */
+    __asm("DMB");
+    *pState = STARTUP_CTORS_DONE;
+    __asm("DSB");
+    __asm("SEV");
+  }
+  else if(State != Running)
+  {
+    while(*pState != STARTUP_CTORS_DONE)
+    {
+      __asm("WFE");
+    }
+
+    __asm("DMB");
+  }
+  else
+  {
+    /* Nested call from a constructor of the tier on this core */
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief Startup_RunCtorList function
+///
+/// \param  pCtorList : constructor table terminated by (unsigned long)-1
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_RunCtorList(const unsigned long* pCtorList)
 {
   unsigned long CtorIdx = 0U;
   
-  while((__STARTUP_RUNTIME_CTORS)[CtorIdx] != ((unsigned long)-1))
+  while(pCtorList[CtorIdx] != ((unsigned long)-1))
   {
-    ((void (*)(void))((__STARTUP_RUNTIME_CTORS)[CtorIdx++]))();
+    ((void (*)(void))(pCtorList[CtorIdx++]))();
   }
 }
 
@@ -0,0 +1,46 @@
+/******************************************************************************************
+  Filename    : Startup.h
+
+  Core        : ARM Cortex-M0+
+
+  MCU         : RP2040
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : C/C++ Runtime Setup (Crt0) header file
+
+******************************************************************************************/
+#ifndef __STARTUP_H__
+#define __STARTUP_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* Constructor tiers, selected with the init priority (see the .ctors section in Memory_Map.ld):
+     C   : __attribute__((constructor(STARTUP_CTOR_PRIO_DEFERRED))) void Init(void) { ... }
+     C++ : Object Obj __attribute__((init_priority(STARTUP_CTOR_PRIO_CORE1)));
+   Priorities 40000..49999 and 50000..59999 belong to the deferred and core 1 tiers,
+   any other priority (or none) is critical and runs before main */
+#define STARTUP_CTOR_PRIO_DEFERRED   40000
+#define STARTUP_CTOR_PRIO_CORE1      50000
+
+#define CTOR_DEFERRED                __attribute__((constructor(STARTUP_CTOR_PRIO_DEFERRED)))
+#define CTOR_CORE1                   __attribute__((constructor(STARTUP_CTOR_PRIO_CORE1)))
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+void Startup_InitDeferredCtors(void);
+void Startup_InitCore1Ctors(void);
+
+#endif /*__STARTUP_H__*/
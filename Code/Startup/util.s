@@ -19,8 +19,8 @@
 
 
 .thumb_func
-.section ".text", "ax"
-.align 8
+.section ".time_critical", "ax"
+.align 2
 .globl BlockingDelay
 .type  BlockingDelay, % function
 
@@ -31,3 +31,85 @@ BlockingDelay:
   bx lr
 
 .size BlockingDelay, .-BlockingDelay
+
+
+// ---------------------------------------------------------------------------------------
+// void Startup_CopyWords(unsigned long* pTarget, const unsigned long* pSource, unsigned long words)
+//
+// Copy a word-aligned block, four words per LDM/STM burst, then the remaining words.
+// ---------------------------------------------------------------------------------------
+.thumb_func
+.section ".text", "ax"
+.align 2
+.globl Startup_CopyWords
+.type  Startup_CopyWords, % function
+
+
+Startup_CopyWords:
+  push  {r4-r6}
+  subs  r2, r2, #4
+  bcc   CopyWords_Tail
+
+CopyWords_Burst:
+  ldmia r1!, {r3-r6}
+  stmia r0!, {r3-r6}
+  subs  r2, r2, #4
+  bcs   CopyWords_Burst
+
+CopyWords_Tail:
+  adds  r2, r2, #4
+  beq   CopyWords_Exit
+
+CopyWords_Single:
+  ldmia r1!, {r3}
+  stmia r0!, {r3}
+  subs  r2, r2, #1
+  bne   CopyWords_Single
+
+CopyWords_Exit:
+  pop   {r4-r6}
+  bx    lr
+
+.size Startup_CopyWords, .-Startup_CopyWords
+
+
+// ---------------------------------------------------------------------------------------
+// void Startup_ClearWords(unsigned long* pTarget, unsigned long words)
+//
+// Clear a word-aligned block, four words per STM burst, then the remaining words.
+// ---------------------------------------------------------------------------------------
+.thumb_func
+.section ".text", "ax"
+.align 2
+.globl Startup_ClearWords
+.type  Startup_ClearWords, % function
+
+
+Startup_ClearWords:
+  push  {r4, r5}
+  movs  r2, #0
+  movs  r3, #0
+  movs  r4, #0
+  movs  r5, #0
+  subs  r1, r1, #4
+  bcc   ClearWords_Tail
+
+ClearWords_Burst:
+  stmia r0!, {r2-r5}
+  subs  r1, r1, #4
+  bcs   ClearWords_Burst
+
+ClearWords_Tail:
+  adds  r1, r1, #4
+  beq   ClearWords_Exit
+
+ClearWords_Single:
+  stmia r0!, {r2}
+  subs  r1, r1, #1
+  bne   ClearWords_Single
+
+ClearWords_Exit:
+  pop   {r4, r5}
+  bx    lr
+
+.size Startup_ClearWords, .-Startup_ClearWords
@@ -39,4 +39,17 @@ typedef enum
 
 #define NULL_PTR    (void*)0
 
+/* Place a function in the .time_critical section (loaded to RAM at startup) */
+#define TIME_CRITICAL(name)    __attribute__((section(".time_critical." #name), noinline)) name
+
+/* Place a variable in the scratch bank of core 0 (SCRATCH_X) or core 1 (SCRATCH_Y) */
+#define SCRATCH_X_DATA         __attribute__((section(".scratch_x")))
+#define SCRATCH_Y_DATA         __attribute__((section(".scratch_y")))
+
+/* Place a variable in RAM that is cleared on a cold boot only (kept across a warm restart) */
+#define RETAINED_BSS_DATA      __attribute__((section(".bss_retained")))
+
+/* Place a variable in RAM that is never initialized by the startup code */
+#define NOINIT_DATA            __attribute__((section(".noinit")))
+
 #endif
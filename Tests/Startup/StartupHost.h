@@ -0,0 +1,41 @@
+/******************************************************************************************
+  Filename    : StartupHost.h
+  
+  Core        : Host (PC)
+  
+  MCU         : -
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Host build of Startup.c for the startup unit tests
+                (include this file instead of Startup.c, the static routines stay visible)
+  
+******************************************************************************************/
+#ifndef __STARTUP_HOST_H__
+#define __STARTUP_HOST_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+/* Cortex-M0+ instructions of Startup.c have no host meaning */
+#define __asm(x)
+
+/* The application entry of Startup.c is not the test entry */
+#define main  Startup_HostAppMain
+#include "Startup.c"
+#undef main
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define STARTUP_HOST_CHECK(cond, ...)  do { if(!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); return(1); } } while(0)
+
+#endif /*__STARTUP_HOST_H__*/
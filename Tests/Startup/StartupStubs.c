@@ -0,0 +1,119 @@
+/******************************************************************************************
+  Filename    : StartupStubs.c
+  
+  Core        : Host (PC)
+  
+  MCU         : -
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Host stand-ins for the util.s routines, the spinlocks and the linker tables of Startup.c
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include <stdint.h>
+
+//=============================================================================
+// Linker tables (empty: the tests never run Startup_Init)
+//=============================================================================
+const unsigned long __RUNTIME_COPY_TABLE[3]       = {(unsigned long)-1, (unsigned long)-1, (unsigned long)-1};
+const unsigned long __RUNTIME_LZ_COPY_TABLE[3]    = {(unsigned long)-1, (unsigned long)-1, (unsigned long)-1};
+const unsigned long __RUNTIME_CLEAR_TABLE[2]      = {(unsigned long)-1, (unsigned long)-1};
+const unsigned long __RUNTIME_COLD_CLEAR_TABLE[2] = {(unsigned long)-1, (unsigned long)-1};
+unsigned long __CPPCTOR_LIST__[1]          = {(unsigned long)-1};
+unsigned long __CPPCTOR_DEFERRED_LIST__[1] = {(unsigned long)-1};
+unsigned long __CPPCTOR_CORE1_LIST__[1]    = {(unsigned long)-1};
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+void Startup_CopyWords(unsigned long* pTarget, const unsigned long* pSource, unsigned long words);
+void Startup_ClearWords(unsigned long* pTarget, unsigned long words);
+unsigned long RP2040_SpinlockAcquire(unsigned long LockId, int boMaskIrq);
+void RP2040_SpinlockRelease(unsigned long LockId, unsigned long Token);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_CopyWords function (C stand-in of util.s, 32-bit words)
+///
+/// \param  pTarget : word-aligned destination
+///         pSource : word-aligned source
+///         words   : number of 32-bit words
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Startup_CopyWords(unsigned long* pTarget, const unsigned long* pSource, unsigned long words)
+{
+  uint32_t* pDst       = (uint32_t*)(void*)pTarget;
+  const uint32_t* pSrc = (const uint32_t*)(const void*)pSource;
+
+  /* util.s requires word alignment (LDM/STM fault otherwise), 0 words access nothing */
+  if((words != 0UL) && ((((uintptr_t)pDst | (uintptr_t)pSrc) & 3U) != 0U))
+  {
+    __builtin_trap();
+  }
+
+  while(words-- != 0UL)
+  {
+    *pDst++ = *pSrc++;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_ClearWords function (C stand-in of util.s, 32-bit words)
+///
+/// \param  pTarget : word-aligned destination
+///         words   : number of 32-bit words
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Startup_ClearWords(unsigned long* pTarget, unsigned long words)
+{
+  uint32_t* pDst = (uint32_t*)(void*)pTarget;
+
+  if((words != 0UL) && (((uintptr_t)pDst & 3U) != 0U))
+  {
+    __builtin_trap();
+  }
+
+  while(words-- != 0UL)
+  {
+    *pDst++ = 0U;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockAcquire function (host stand-in, single thread)
+///
+/// \param  LockId    : hardware spinlock
+///         boMaskIrq : unused (boolean)
+///
+/// \return token passed back to RP2040_SpinlockRelease
+//-----------------------------------------------------------------------------------------
+unsigned long RP2040_SpinlockAcquire(unsigned long LockId, int boMaskIrq)
+{
+  (void)LockId;
+  (void)boMaskIrq;
+
+  return(0UL);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RP2040_SpinlockRelease function (host stand-in, single thread)
+///
+/// \param  LockId : hardware spinlock
+///         Token  : value returned by RP2040_SpinlockAcquire
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void RP2040_SpinlockRelease(unsigned long LockId, unsigned long Token)
+{
+  (void)LockId;
+  (void)Token;
+}
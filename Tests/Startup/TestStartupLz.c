@@ -0,0 +1,246 @@
+/******************************************************************************************
+  Filename    : TestStartupLz.c
+  
+  Core        : Host (PC)
+  
+  MCU         : -
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Host test of Startup_LzCopy (the boot decoder of Tools/DataLz.py)
+
+                TestStartupLz                     : built-in edge-case streams
+                TestStartupLz <data.bin> <data.lz> : decodes data.lz, compares with data.bin
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "StartupHost.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define TEST_LZ_MAX_SIZE   512U
+#define TEST_LZ_GUARD      0xA5U
+
+//=============================================================================
+// Types definition
+//=============================================================================
+typedef struct
+{
+  const char*          pName;
+  const unsigned char* pStream;
+  unsigned long        u32StreamSize;
+  const unsigned char* pExpected;
+  unsigned long        u32Size;
+}Test_LzVectorType;
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+static int Test_LzDecode(const char* pName, const unsigned char* pStream, const unsigned char* pExpected, unsigned long Size);
+static int Test_LzVectors(void);
+static int Test_LzFiles(const char* pDataFile, const char* pLzFile);
+static unsigned char* Test_ReadFile(const char* pFile, unsigned long* pSize);
+
+//=============================================================================
+// Test vectors (token, [literal ext], literals, offset, [match ext], ...)
+//=============================================================================
+/* Empty .data: a single empty literal run */
+static const unsigned char Test_EmptyStream[] = {0x00};
+
+/* Literal-only input shorter than a match */
+static const unsigned char Test_LiteralStream[]   = {0x30, 'a', 'b', 'c'};
+static const unsigned char Test_LiteralExpected[] = {'a', 'b', 'c'};
+
+/* Literal-only input with an extended literal length (15 + 5) */
+static const unsigned char Test_LongLiteralStream[] = {0xF0, 0x05,
+                                                       'A','B','C','D','E','F','G','H','I','J',
+                                                       'K','L','M','N','O','P','Q','R','S','T'};
+static const unsigned char Test_LongLiteralExpected[] = {'A','B','C','D','E','F','G','H','I','J',
+                                                         'K','L','M','N','O','P','Q','R','S','T'};
+
+/* Overlapping match, offset 1 < length 12 (run-length), output ends on the match */
+static const unsigned char Test_RunStream[]   = {0x18, 'z', 0x01, 0x00, 0x00};
+static const unsigned char Test_RunExpected[] = {'z','z','z','z','z','z','z','z','z','z','z','z','z'};
+
+/* Overlapping match, offset 2 < length 10 */
+static const unsigned char Test_PatternStream[]   = {0x26, 'a', 'b', 0x02, 0x00, 0x00};
+static const unsigned char Test_PatternExpected[] = {'a','b','a','b','a','b','a','b','a','b','a','b'};
+
+/* Last literal run after a match (the final sequence has no offset) */
+static const unsigned char Test_TailStream[]   = {0x40, 'a', 'b', 'c', 'd', 0x04, 0x00, 0x30, 'x', 'y', 'z'};
+static const unsigned char Test_TailExpected[] = {'a','b','c','d','a','b','c','d','x','y','z'};
+
+/* Extended match length: 4 + 15 + 255 + 3 = 277 bytes at offset 1, then 2 literals */
+static const unsigned char Test_LongMatchStream[] = {0x1F, 'q', 0x01, 0x00, 0xFF, 0x03, 0x20, 'r', 's'};
+static unsigned char Test_LongMatchExpected[1U + 277U + 2U];
+
+static const Test_LzVectorType Test_LzVectors_[] =
+{
+  {"empty",          Test_EmptyStream,       sizeof(Test_EmptyStream),       NULL,                     0UL},
+  {"literal only",   Test_LiteralStream,     sizeof(Test_LiteralStream),     Test_LiteralExpected,     sizeof(Test_LiteralExpected)},
+  {"long literal",   Test_LongLiteralStream, sizeof(Test_LongLiteralStream), Test_LongLiteralExpected, sizeof(Test_LongLiteralExpected)},
+  {"overlap off 1",  Test_RunStream,         sizeof(Test_RunStream),         Test_RunExpected,         sizeof(Test_RunExpected)},
+  {"overlap off 2",  Test_PatternStream,     sizeof(Test_PatternStream),     Test_PatternExpected,     sizeof(Test_PatternExpected)},
+  {"last literals",  Test_TailStream,        sizeof(Test_TailStream),        Test_TailExpected,        sizeof(Test_TailExpected)},
+  {"long match",     Test_LongMatchStream,   sizeof(Test_LongMatchStream),   Test_LongMatchExpected,   sizeof(Test_LongMatchExpected)},
+};
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Test_LzDecode function
+///
+/// \param  pName     : vector name (reports)
+///         pStream   : compressed stream
+///         pExpected : expected output
+///         Size      : expected output size
+///
+/// \return 0 on success
+//-----------------------------------------------------------------------------------------
+static int Test_LzDecode(const char* pName, const unsigned char* pStream, const unsigned char* pExpected, unsigned long Size)
+{
+  unsigned char* pOut = malloc(Size + 8UL);
+
+  STARTUP_HOST_CHECK(pOut != NULL, "%s: out of memory", pName);
+
+  /* Guard bytes: the decoder must stop exactly at the requested size */
+  memset(pOut, TEST_LZ_GUARD, Size + 8UL);
+
+  Startup_LzCopy((unsigned long)pOut, (unsigned long)pStream, Size);
+
+  for(unsigned long Index = 0UL; Index < Size; Index++)
+  {
+    if(pOut[Index] != pExpected[Index])
+    {
+      printf("FAIL: %s: byte %lu is 0x%02X, expected 0x%02X\n", pName, Index, pOut[Index], pExpected[Index]);
+      free(pOut);
+      return(1);
+    }
+  }
+
+  for(unsigned long Index = Size; Index < (Size + 8UL); Index++)
+  {
+    if(pOut[Index] != TEST_LZ_GUARD)
+    {
+      printf("FAIL: %s: write past the end at byte %lu\n", pName, Index);
+      free(pOut);
+      return(1);
+    }
+  }
+
+  free(pOut);
+
+  return(0);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Test_LzVectors function
+///
+/// \param  void
+///
+/// \return number of failed vectors
+//-----------------------------------------------------------------------------------------
+static int Test_LzVectors(void)
+{
+  int Failures = 0;
+
+  memset(Test_LongMatchExpected, 'q', 1U + 277U);
+  Test_LongMatchExpected[278] = 'r';
+  Test_LongMatchExpected[279] = 's';
+
+  for(unsigned long Index = 0UL; Index < (sizeof(Test_LzVectors_) / sizeof(Test_LzVectors_[0])); Index++)
+  {
+    const Test_LzVectorType* const pVector = &Test_LzVectors_[Index];
+
+    Failures += Test_LzDecode(pVector->pName, pVector->pStream, pVector->pExpected, pVector->u32Size);
+  }
+
+  return(Failures);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Test_ReadFile function
+///
+/// \param  pFile : file name
+///         pSize : file size
+///
+/// \return file contents (malloc), NULL on error
+//-----------------------------------------------------------------------------------------
+static unsigned char* Test_ReadFile(const char* pFile, unsigned long* pSize)
+{
+  FILE* pStream = fopen(pFile, "rb");
+  unsigned char* pData;
+  long Size;
+
+  if(pStream == NULL)
+  {
+    return(NULL);
+  }
+
+  (void)fseek(pStream, 0L, SEEK_END);
+  Size = ftell(pStream);
+  (void)fseek(pStream, 0L, SEEK_SET);
+
+  /* One spare byte: malloc(0) may return NULL for an empty .data */
+  pData = malloc((size_t)Size + 1U);
+
+  if((pData != NULL) && (fread(pData, 1U, (size_t)Size, pStream) != (size_t)Size))
+  {
+    free(pData);
+    pData = NULL;
+  }
+
+  (void)fclose(pStream);
+
+  *pSize = (unsigned long)Size;
+
+  return(pData);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Test_LzFiles function
+///
+/// \param  pDataFile : original .data image
+///         pLzFile   : its DataLz.py stream
+///
+/// \return 0 on success
+//-----------------------------------------------------------------------------------------
+static int Test_LzFiles(const char* pDataFile, const char* pLzFile)
+{
+  unsigned long DataSize;
+  unsigned long LzSize;
+  unsigned char* pData   = Test_ReadFile(pDataFile, &DataSize);
+  unsigned char* pStream = Test_ReadFile(pLzFile, &LzSize);
+  int Result;
+
+  STARTUP_HOST_CHECK((pData != NULL) && (pStream != NULL), "cannot read %s or %s", pDataFile, pLzFile);
+
+  Result = Test_LzDecode(pDataFile, pStream, pData, DataSize);
+
+  free(pData);
+  free(pStream);
+
+  return(Result);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  main function
+///
+/// \param  argc, argv : optional <data.bin> <data.lz> pair
+///
+/// \return 0 if all the checks passed
+//-----------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  const int Failures = (argc == 3) ? Test_LzFiles(argv[1], argv[2]) : Test_LzVectors();
+
+  printf("+++ TestStartupLz: %s\n", (Failures == 0) ? "passed" : "FAILED");
+
+  return((Failures == 0) ? 0 : 1);
+}
@@ -0,0 +1,155 @@
+/******************************************************************************************
+  Filename    : TestStartupMem.c
+  
+  Core        : Host (PC)
+  
+  MCU         : -
+    
+  Author      : Chalandi Amine
+ 
+  Owner       : Chalandi Amine
+  
+  Date        : 17.10.2026
+  
+  Description : Host test of Startup_MemCopy/Startup_MemClear (head/body/tail split)
+                against the plain byte loop
+  
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "StartupHost.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define TEST_MEM_MAX_SIZE   96UL   /* several 4-word bursts plus every tail length */
+#define TEST_MEM_MARGIN     8UL
+#define TEST_MEM_BUF_SIZE   (TEST_MEM_MARGIN + 3UL + TEST_MEM_MAX_SIZE + TEST_MEM_MARGIN)
+
+//=============================================================================
+// Globals
+//=============================================================================
+/* Word-aligned buffers, the misalignment is applied on top */
+static unsigned long Test_Source[TEST_MEM_BUF_SIZE / sizeof(unsigned long) + 1U];
+static unsigned long Test_Target[TEST_MEM_BUF_SIZE / sizeof(unsigned long) + 1U];
+static unsigned long Test_Reference[TEST_MEM_BUF_SIZE / sizeof(unsigned long) + 1U];
+
+//=============================================================================
+// Functions prototype
+//=============================================================================
+static void Test_Fill(unsigned char* pBuffer, unsigned char Seed);
+static int Test_MemCopy(void);
+static int Test_MemClear(void);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Test_Fill function
+///
+/// \param  pBuffer : buffer of TEST_MEM_BUF_SIZE bytes
+///         Seed    : pattern seed
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Test_Fill(unsigned char* pBuffer, unsigned char Seed)
+{
+  for(unsigned long Index = 0UL; Index < TEST_MEM_BUF_SIZE; Index++)
+  {
+    pBuffer[Index] = (unsigned char)((Index * 7UL) + Seed);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Test_MemCopy function
+///
+/// \param  void
+///
+/// \return 0 on success
+//-----------------------------------------------------------------------------------------
+static int Test_MemCopy(void)
+{
+  unsigned char* const pSource    = (unsigned char*)Test_Source;
+  unsigned char* const pTarget    = (unsigned char*)Test_Target;
+  unsigned char* const pReference = (unsigned char*)Test_Reference;
+
+  for(unsigned long SrcAlign = 0UL; SrcAlign < 4UL; SrcAlign++)
+  {
+    for(unsigned long DstAlign = 0UL; DstAlign < 4UL; DstAlign++)
+    {
+      for(unsigned long Size = 0UL; Size <= TEST_MEM_MAX_SIZE; Size++)
+      {
+        const unsigned long Src = TEST_MEM_MARGIN + SrcAlign;
+        const unsigned long Dst = TEST_MEM_MARGIN + DstAlign;
+
+        Test_Fill(pSource, 0x11U);
+        Test_Fill(pTarget, 0xC3U);
+        Test_Fill(pReference, 0xC3U);
+
+        /* Reference: the byte loop */
+        for(unsigned long Index = 0UL; Index < Size; Index++)
+        {
+          pReference[Dst + Index] = pSource[Src + Index];
+        }
+
+        Startup_MemCopy((unsigned long)&pTarget[Dst], (unsigned long)&pSource[Src], Size);
+
+        STARTUP_HOST_CHECK(memcmp(pTarget, pReference, TEST_MEM_BUF_SIZE) == 0,
+                           "Startup_MemCopy src+%lu dst+%lu size %lu", SrcAlign, DstAlign, Size);
+      }
+    }
+  }
+
+  return(0);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Test_MemClear function
+///
+/// \param  void
+///
+/// \return 0 on success
+//-----------------------------------------------------------------------------------------
+static int Test_MemClear(void)
+{
+  unsigned char* const pTarget    = (unsigned char*)Test_Target;
+  unsigned char* const pReference = (unsigned char*)Test_Reference;
+
+  for(unsigned long DstAlign = 0UL; DstAlign < 4UL; DstAlign++)
+  {
+    for(unsigned long Size = 0UL; Size <= TEST_MEM_MAX_SIZE; Size++)
+    {
+      const unsigned long Dst = TEST_MEM_MARGIN + DstAlign;
+
+      Test_Fill(pTarget, 0x5AU);
+      Test_Fill(pReference, 0x5AU);
+
+      for(unsigned long Index = 0UL; Index < Size; Index++)
+      {
+        pReference[Dst + Index] = 0U;
+      }
+
+      Startup_MemClear((unsigned long)&pTarget[Dst], Size);
+
+      STARTUP_HOST_CHECK(memcmp(pTarget, pReference, TEST_MEM_BUF_SIZE) == 0,
+                         "Startup_MemClear dst+%lu size %lu", DstAlign, Size);
+    }
+  }
+
+  return(0);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  main function
+///
+/// \param  void
+///
+/// \return 0 if all the checks passed
+//-----------------------------------------------------------------------------------------
+int main(void)
+{
+  const int Failures = Test_MemCopy() + Test_MemClear();
+
+  printf("+++ TestStartupMem: %s\n", (Failures == 0) ? "passed" : "FAILED");
+
+  return((Failures == 0) ? 0 : 1);
+}
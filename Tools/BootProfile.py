@@ -0,0 +1,122 @@
+#####################################################################################
+#
+# Filename    : BootProfile.py
+#
+# Author      : Chalandi Amine
+#
+# Owner       : Chalandi Amine
+#
+# Date        : 17.10.2026
+#
+# Description : Decode the boot phase record (BootProfile_Record) from a RAM dump
+#
+#####################################################################################
+
+import sys
+import struct
+import argparse
+
+# Layout of BootProfile_Type (Code/Startup/BootProfile.h)
+BOOT_PROFILE_MAGIC  = 0x544F4F42
+BOOT_PROFILE_SYMBOL = "BootProfile_Record"
+BOOT_PROFILE_FORMAT = "<IIII6Q"
+BOOT_PROFILE_PHASES = ["ENTRY", "CORE", "CLOCK", "RAM", "CTORS", "CORE1_START"]
+
+# u32Flags: the phases up to CLOCK were timed on the nominal ROSC tick
+BOOT_PROFILE_FLAG_ROSC_TICK = 0x00000001
+BOOT_PROFILE_ROSC_PHASES    = ["CORE", "CLOCK"]
+
+# Command-line syntax :  py  BootProfile.py  <RamDump>  {--elf <ElfFile> | --address <Addr>}  [--base <Addr>] [--csv]
+
+def GetSymbolAddress(ElfFile, SymbolName):
+    with open(ElfFile, "rb") as f:
+        Elf = f.read()
+
+    if Elf[0:4] != b"\x7fELF" or Elf[4] != 1:
+        sys.exit("error: " + ElfFile + " is not an ELF32 file")
+
+    e_shoff, = struct.unpack_from("<I", Elf, 0x20)
+    e_shentsize, e_shnum = struct.unpack_from("<HH", Elf, 0x2E)
+
+    Sections = [struct.unpack_from("<IIIIIIIIII", Elf, e_shoff + i * e_shentsize) for i in range(e_shnum)]
+
+    for Section in Sections:
+        # SHT_SYMTAB
+        if Section[1] != 2:
+            continue
+
+        StrTab = Sections[Section[6]]
+        for Offset in range(Section[4], Section[4] + Section[5], 16):
+            st_name, st_value = struct.unpack_from("<II", Elf, Offset)
+            NameStart = StrTab[4] + st_name
+            Name = Elf[NameStart:Elf.index(b"\x00", NameStart)].decode()
+            if Name == SymbolName:
+                return st_value
+
+    sys.exit("error: symbol " + SymbolName + " not found in " + ElfFile)
+
+
+def main():
+    Parser = argparse.ArgumentParser(description="Decode the boot phase record from a RAM dump")
+    Parser.add_argument("RamDump", help="raw binary RAM dump")
+    Parser.add_argument("--elf", help="ELF file providing the address of " + BOOT_PROFILE_SYMBOL)
+    Parser.add_argument("--address", type=lambda x: int(x, 0), help="address of " + BOOT_PROFILE_SYMBOL)
+    Parser.add_argument("--base", type=lambda x: int(x, 0), default=0x20000000, help="address of the first byte of the dump")
+    Parser.add_argument("--csv", action="store_true", help="print one CSV line (phase durations in ticks)")
+    Args = Parser.parse_args()
+
+    if Args.elf is not None:
+        Address = GetSymbolAddress(Args.elf, BOOT_PROFILE_SYMBOL)
+    elif Args.address is not None:
+        Address = Args.address
+    else:
+        sys.exit("error: --elf or --address is required")
+
+    with open(Args.RamDump, "rb") as f:
+        f.seek(Address - Args.base)
+        Raw = f.read(struct.calcsize(BOOT_PROFILE_FORMAT))
+
+    if len(Raw) != struct.calcsize(BOOT_PROFILE_FORMAT):
+        sys.exit("error: the dump does not contain the boot profile record")
+
+    Record = struct.unpack(BOOT_PROFILE_FORMAT, Raw)
+    Magic, TickCycles, StampedMask, Flags = Record[0], Record[1], Record[2], Record[3]
+    RoscTick = (Flags & BOOT_PROFILE_FLAG_ROSC_TICK) != 0
+    Stamps = Record[4:]
+
+    if Magic != BOOT_PROFILE_MAGIC:
+        sys.exit("error: invalid boot profile magic 0x%08X" % Magic)
+
+    Durations = []
+    Previous = Stamps[0]
+    for Phase in range(1, len(BOOT_PROFILE_PHASES)):
+        if StampedMask & (1 << Phase):
+            Durations.append(Stamps[Phase] - Previous)
+            Previous = Stamps[Phase]
+        else:
+            Durations.append(None)
+
+    RoscNote = "note: %s timed on the nominal ROSC tick, not us-accurate (compare them on the same board only)" % "/".join(BOOT_PROFILE_ROSC_PHASES)
+
+    if Args.csv:
+        print(",".join("" if d is None else str(d) for d in Durations))
+        if RoscTick:
+            print(RoscNote, file=sys.stderr)
+        return
+
+    print("tick = %d clk_ref cycles%s" % (TickCycles, " (ROSC, nominal)" if RoscTick else ""))
+    print("%-12s %20s %12s" % ("phase", "stamp", "duration"))
+    print("%-12s %20d %12s" % (BOOT_PROFILE_PHASES[0], Stamps[0], "-"))
+    for Phase in range(1, len(BOOT_PROFILE_PHASES)):
+        Mark = "~" if (RoscTick and BOOT_PROFILE_PHASES[Phase] in BOOT_PROFILE_ROSC_PHASES) else " "
+        if Durations[Phase - 1] is None:
+            print("%-12s %20s %12s" % (BOOT_PROFILE_PHASES[Phase], "not stamped", "-"))
+        else:
+            print("%-12s %20d %11d%s" % (BOOT_PROFILE_PHASES[Phase], Stamps[Phase], Durations[Phase - 1], Mark))
+
+    if RoscTick:
+        print("~ " + RoscNote)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,173 @@
+#####################################################################################
+#
+# Filename    : DataLz.py
+#
+# Author      : Chalandi Amine
+#
+# Owner       : Chalandi Amine
+#
+# Date        : 17.10.2026
+#
+# Description : LZ compressor for the .data load image (decoded by Startup_LzCopy)
+#
+#####################################################################################
+
+import sys
+
+# Stream format (LZ4 block layout):
+#   token       : [7:4] literal length, [3:0] match length - 4 (15 = extended)
+#   [ext bytes] : literal length extension, 255 = continue
+#   literals
+#   offset      : 2 bytes little-endian, distance back into the output (1..65535)
+#   [ext bytes] : match length extension, 255 = continue
+# The last sequence carries literals only and ends when the output is complete.
+
+LZ_MIN_MATCH  = 4
+LZ_MAX_OFFSET = 0xFFFF
+
+# Command-line syntax :  py  DataLz.py  <InputFile>  <OutputFile>
+#                        py  DataLz.py  --report  <RawFlashImage>  <LzFlashImage>
+
+def WriteLength(Out, Length):
+    while Length >= 255:
+        Out.append(255)
+        Length -= 255
+    Out.append(Length)
+
+
+def WriteSequence(Out, Literals, MatchLength, Offset):
+    LitLen = len(Literals)
+    Token  = (min(LitLen, 15) << 4)
+
+    if Offset != 0:
+        Token |= min(MatchLength - LZ_MIN_MATCH, 15)
+
+    Out.append(Token)
+
+    if LitLen >= 15:
+        WriteLength(Out, LitLen - 15)
+
+    Out += Literals
+
+    if Offset != 0:
+        Out.append(Offset & 0xFF)
+        Out.append(Offset >> 8)
+        if MatchLength - LZ_MIN_MATCH >= 15:
+            WriteLength(Out, MatchLength - LZ_MIN_MATCH - 15)
+
+
+def Compress(Data):
+    Out     = bytearray()
+    Table   = {}
+    Pos     = 0
+    Anchor  = 0
+    Size    = len(Data)
+
+    while Pos + LZ_MIN_MATCH <= Size:
+        Key       = Data[Pos:Pos + LZ_MIN_MATCH]
+        Candidate = Table.get(Key)
+        Table[Key] = Pos
+
+        if Candidate is not None and Pos - Candidate <= LZ_MAX_OFFSET:
+            Length = LZ_MIN_MATCH
+            while Pos + Length < Size and Data[Candidate + Length] == Data[Pos + Length]:
+                Length += 1
+
+            WriteSequence(Out, Data[Anchor:Pos], Length, Pos - Candidate)
+
+            # Index the positions covered by the match (keeps the ratio on repetitive tables)
+            for Index in range(Pos + 1, min(Pos + Length, Size - LZ_MIN_MATCH + 1)):
+                Table[Data[Index:Index + LZ_MIN_MATCH]] = Index
+
+            Pos   += Length
+            Anchor = Pos
+        else:
+            Pos += 1
+
+    # Final literal-only sequence (may be empty)
+    WriteSequence(Out, Data[Anchor:], 0, 0)
+
+    return bytes(Out)
+
+
+def ReadLength(Src, Pos):
+    Length = 0
+    while True:
+        Ext = Src[Pos]
+        Pos += 1
+        Length += Ext
+        if Ext != 255:
+            return Length, Pos
+
+
+def Decompress(Src, Size):
+    Out = bytearray()
+    Pos = 0
+
+    while len(Out) < Size:
+        Token = Src[Pos]
+        Pos += 1
+
+        Length = Token >> 4
+        if Length == 15:
+            Ext, Pos = ReadLength(Src, Pos)
+            Length += Ext
+
+        Out += Src[Pos:Pos + Length]
+        Pos += Length
+
+        if len(Out) >= Size:
+            break
+
+        Offset = Src[Pos] | (Src[Pos + 1] << 8)
+        Pos += 2
+
+        Length = (Token & 0x0F) + LZ_MIN_MATCH
+        if (Token & 0x0F) == 15:
+            Ext, Pos = ReadLength(Src, Pos)
+            Length += Ext
+
+        for _ in range(Length):
+            Out.append(Out[-Offset])
+
+    return bytes(Out)
+
+
+def Report(RawFile, LzFile):
+    # Flash images (objcopy -O binary) of the first link and of the flashed DATA_LZ link
+    with open(RawFile, "rb") as f:
+        RawSize = len(f.read())
+
+    with open(LzFile, "rb") as f:
+        LzSize = len(f.read())
+
+    print("+++ flash image: %d -> %d bytes (%d bytes saved)" % (RawSize, LzSize, RawSize - LzSize))
+
+
+def main():
+    if len(sys.argv) == 4 and sys.argv[1] == "--report":
+        Report(sys.argv[2], sys.argv[3])
+        return
+
+    if len(sys.argv) != 3:
+        print("Command-line syntax :  py  DataLz.py  <InputFile>  <OutputFile>")
+        print("                       py  DataLz.py  --report  <RawFlashImage>  <LzFlashImage>")
+        sys.exit(1)
+
+    with open(sys.argv[1], "rb") as f:
+        Data = f.read()
+
+    Packed = Compress(Data)
+
+    # Round-trip check: never ship an image the startup decoder would not restore exactly
+    if Decompress(Packed, len(Data)) != Data:
+        sys.exit("error: LZ round-trip mismatch for " + sys.argv[1])
+
+    with open(sys.argv[2], "wb") as f:
+        f.write(Packed)
+
+    print("+++ .data LZ image: %d -> %d bytes" % (len(Data), len(Packed)))
+
+
+if __name__ == "__main__":
+    main()